@@ -49,6 +49,7 @@
 #include <ngraph/runtime/reference/hard_sigmoid.hpp>
 #include <ngraph/runtime/reference/if.hpp>
 #include <ngraph/runtime/reference/interpolate.hpp>
+#include <ngraph/runtime/reference/irdft.hpp>
 #include <ngraph/runtime/reference/log.hpp>
 #include <ngraph/runtime/reference/log_softmax.hpp>
 #include <ngraph/runtime/reference/lrn.hpp>
@@ -64,6 +65,7 @@
 #include <ngraph/runtime/reference/prior_box.hpp>
 #include <ngraph/runtime/reference/proposal.hpp>
 #include <ngraph/runtime/reference/psroi_pooling.hpp>
+#include <ngraph/runtime/reference/rdft.hpp>
 #include <ngraph/runtime/reference/region_yolo.hpp>
 #include <ngraph/runtime/reference/reorg_yolo.hpp>
 #include <ngraph/runtime/reference/reverse_sequence.hpp>
@@ -2105,6 +2107,81 @@ bool evaluate(const shared_ptr<op::v7::IDFT>& op, const HostTensorVector& output
     return true;
 }
 
+namespace fft_v9 {
+// Applies the signal sizes to the dimensions of the canonical axes
+Shape get_output_shape_for_fft9_eval(const std::vector<std::shared_ptr<HostTensor>>& inputs,
+                                     Shape output_shape,
+                                     const std::vector<int64_t>& canonicalized_axes) {
+    const auto signal_size = fft_v7::get_signal_size(inputs, canonicalized_axes.size());
+    for (size_t i = 0; i < canonicalized_axes.size(); ++i) {
+        if (signal_size[i] != -1) {
+            output_shape[canonicalized_axes[i]] = signal_size[i];
+        }
+    }
+    return output_shape;
+}
+}  // namespace fft_v9
+
+template <element::Type_t ET>
+bool evaluate(const shared_ptr<op::v9::RDFT>& op, const HostTensorVector& outputs, const HostTensorVector& inputs) {
+    const auto input_data_shape = inputs[0]->get_shape();
+    const auto input_data = get_floats(inputs[0], input_data_shape);
+    const auto axes_data = get_integers(inputs[1], inputs[1]->get_shape());
+    const auto canonicalized_axes = runtime::reference::canonicalize_axes(axes_data.data(),
+                                                                          inputs[1]->get_shape(),
+                                                                          static_cast<int64_t>(input_data_shape.size()));
+
+    auto output_fft_shape = fft_v9::get_output_shape_for_fft9_eval(inputs, input_data_shape, canonicalized_axes);
+    output_fft_shape.push_back(2);
+
+    // only the first half of the spectrum is computed along the last of the axes
+    const auto last_axis = canonicalized_axes.back();
+    auto output_shape = output_fft_shape;
+    output_shape[last_axis] = output_fft_shape[last_axis] / 2 + 1;
+    outputs[0]->set_shape(output_shape);
+
+    std::vector<float> rdft_result(shape_size(output_shape), 0.0f);
+    runtime::reference::rdft(input_data.data(),
+                             input_data_shape,
+                             canonicalized_axes,
+                             output_fft_shape,
+                             rdft_result.data());
+
+    const auto output_type = op->get_input_element_type(0);
+    runtime::reference::fft_postprocessing(outputs, output_type, rdft_result);
+    return true;
+}
+
+template <element::Type_t ET>
+bool evaluate(const shared_ptr<op::v9::IRDFT>& op, const HostTensorVector& outputs, const HostTensorVector& inputs) {
+    const auto input_data_shape = inputs[0]->get_shape();
+    const auto input_data = get_floats(inputs[0], input_data_shape);
+    const auto axes_data = get_integers(inputs[1], inputs[1]->get_shape());
+    const auto complex_data_rank = static_cast<int64_t>(input_data_shape.size()) - 1;
+    const auto canonicalized_axes =
+        runtime::reference::canonicalize_axes(axes_data.data(), inputs[1]->get_shape(), complex_data_rank);
+
+    const Shape complex_data_shape(input_data_shape.begin(), input_data_shape.end() - 1);
+    auto output_shape = fft_v9::get_output_shape_for_fft9_eval(inputs, complex_data_shape, canonicalized_axes);
+    // the input along the last of the axes is the first half of the spectrum by default
+    const auto last_axis = canonicalized_axes.back();
+    if (fft_v7::get_signal_size(inputs, canonicalized_axes.size()).back() == -1) {
+        output_shape[last_axis] = 2 * (complex_data_shape[last_axis] - 1);
+    }
+    outputs[0]->set_shape(output_shape);
+
+    std::vector<float> irdft_result(shape_size(output_shape), 0.0f);
+    runtime::reference::irdft(input_data.data(),
+                              input_data_shape,
+                              canonicalized_axes,
+                              irdft_result.data(),
+                              output_shape);
+
+    const auto output_type = op->get_input_element_type(0);
+    runtime::reference::fft_postprocessing(outputs, output_type, irdft_result);
+    return true;
+}
+
 template <element::Type_t ET>
 bool evaluate(const shared_ptr<op::v0::LRN>& op, const HostTensorVector& outputs, const HostTensorVector& inputs) {
     using T = typename element_type_traits<ET>::value_type;
@@ -124,6 +124,9 @@ NGRAPH_OP(NV12toBGR, op::v8)
 NGRAPH_OP(I420toRGB, op::v8)
 NGRAPH_OP(I420toBGR, op::v8)
 
+NGRAPH_OP(IRDFT, op::v9)
+NGRAPH_OP(RDFT, op::v9)
+
 NGRAPH_OP(Sigmoid, op::v0)
 NGRAPH_OP(Tanh, op::v0)
 NGRAPH_OP(Exp, op::v0)
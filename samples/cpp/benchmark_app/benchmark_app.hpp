@@ -88,6 +88,23 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables the open-loop mode: the inference requests are started at the given rate (requests per "
+    "second) independently of the completion of the previous ones, the latencies include the time the request "
+    "waited for an idle infer request (coordinated omission correction). By default the closed-loop mode is used, "
+    "where a new request is started as soon as one of -nireq requests completes.";
+
+/// @brief message for open-loop arrival distribution
+static const char arrival_distribution_message[] =
+    "Optional. Distribution of the intervals between the requests in the open-loop mode: \"constant\" (default) or "
+    "\"poisson\".";
+
+/// @brief message for per-request timestamps dump
+static const char latency_csv_message[] =
+    "Optional. Path to a CSV file to store the scheduled start, start and end timestamps and the latency of each "
+    "inference request.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -280,6 +297,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Open-loop arrival rate in requests per second (default 0 means closed-loop)
+DEFINE_double(rate, 0, arrival_rate_message);
+
+/// @brief Distribution of the open-loop arrival intervals
+DEFINE_string(arrival, "constant", arrival_distribution_message);
+
+/// @brief Path to the per-request timestamps CSV file
+DEFINE_string(latency_csv, "", latency_csv_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -390,6 +416,8 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -rate \"<double>\"          " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival \"<constant/poisson>\"  " << arrival_distribution_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -405,6 +433,7 @@ static void show_usage() {
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
+    std::cout << "    -latency_csv \"<path>\"     " << latency_csv_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
     std::cout << "    -infer_precision \"<element type>\"" << inference_precision_message << std::endl;
@@ -48,6 +48,15 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        _scheduledTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which was scheduled to start at the given time (open-loop mode), the time spent
+    /// waiting for this request to become idle is included into the response time
+    void start_async(Time::time_point scheduledTime) {
+        _startTime = Time::now();
+        _scheduledTime = std::min(scheduledTime, _startTime);
         _request.start_async();
     }
 
@@ -57,6 +66,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _scheduledTime = _startTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
@@ -84,10 +94,36 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_response_time_in_milliseconds() const {
+        auto responseTime = std::chrono::duration_cast<ns>(_endTime - _scheduledTime);
+        return static_cast<double>(responseTime.count()) * 0.000001;
+    }
+
+    Time::time_point get_scheduled_time() const {
+        return _scheduledTime;
+    }
+
+    Time::time_point get_start_time() const {
+        return _startTime;
+    }
+
+    Time::time_point get_end_time() const {
+        return _endTime;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
 
+    /// @brief Sets the number of the benchmark iteration executed by the request
+    void set_iteration(size_t iteration) {
+        _iteration = iteration;
+    }
+
+    size_t get_iteration() const {
+        return _iteration;
+    }
+
     // in case of using GPU memory we need to allocate CL buffer for
     // output blobs. By encapsulating cl buffer inside InferReqWrap
     // we will control the number of output buffers and access to it.
@@ -97,14 +133,25 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _scheduledTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
     size_t _lat_group_id;
+    size_t _iteration = 0;
     QueueCallbackFunction _callbackQueue;
     std::map<std::string, ::gpu::BufferType> outputClBuffer;
 };
 
+/// @brief Timestamps of a single inference
+struct RequestTimestamps {
+    size_t iteration;
+    size_t request_id;
+    Time::time_point scheduled;
+    Time::time_point start;
+    Time::time_point end;
+};
+
 class InferRequestsQueue final {
 public:
     InferRequestsQueue(ov::CompiledModel& model, size_t nireq, size_t lat_group_n, bool enable_lat_groups)
@@ -137,6 +184,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _response_latencies.clear();
+        _timestamps.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -149,6 +198,15 @@ public:
     void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        const auto& request = requests.at(id);
+        _response_latencies.push_back(request->get_response_time_in_milliseconds());
+        if (_record_timestamps) {
+            _timestamps.push_back({request->get_iteration(),
+                                   id,
+                                   request->get_scheduled_time(),
+                                   request->get_start_time(),
+                                   request->get_end_time()});
+        }
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -179,10 +237,24 @@ public:
         return _latencies;
     }
 
+    /// @brief Latencies measured from the scheduled start of the requests, equal to the latencies in the
+    /// closed-loop mode
+    std::vector<double> get_response_latencies() {
+        return _response_latencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
 
+    void set_timestamps_recording(bool enable) {
+        _record_timestamps = enable;
+    }
+
+    std::vector<RequestTimestamps> get_timestamps() {
+        return _timestamps;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -192,6 +264,9 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _response_latencies;
     std::vector<std::vector<double>> _latency_groups;
+    std::vector<RequestTimestamps> _timestamps;
+    bool _record_timestamps = false;
     bool enable_lat_groups;
 };
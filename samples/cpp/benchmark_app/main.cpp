@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +57,16 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("The arrival rate is incorrect. Please set -rate option to a positive value.");
+    }
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop mode (-rate option) is supported only with `async` API.");
+    }
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or "
+                               "`poisson` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -725,7 +737,8 @@ int main(int argc, char* argv[]) {
         // Iteration limit
         uint32_t niter = FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        const bool openLoop = FLAGS_rate > 0;
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             if (shape_groups_num > nireq) {
                 niter = ((niter + shape_groups_num - 1) / shape_groups_num) * shape_groups_num;
                 if (FLAGS_niter != niter) {
@@ -766,6 +779,13 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("number of iterations", "iterations_num", niter),
                      StatisticsVariant("number of parallel infer requests", "nireq", nireq),
                      StatisticsVariant("duration (ms)", "duration", get_duration_in_milliseconds(duration_seconds))}));
+            if (openLoop) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("load mode", "load_mode", "open-loop"),
+                     StatisticsVariant("arrival rate (requests/s)", "arrival_rate", FLAGS_rate),
+                     StatisticsVariant("arrival distribution", "arrival_distribution", FLAGS_arrival)});
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -785,6 +805,7 @@ int main(int argc, char* argv[]) {
         next_step();
 
         InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), FLAGS_pcseq);
+        inferRequestsQueue.set_timestamps_recording(!FLAGS_latency_csv.empty());
 
         bool inputHasName = false;
         if (inputFiles.size() > 0) {
@@ -956,13 +977,27 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // open-loop mode: the requests are started at the scheduled arrival times, which do not depend on the
+        // completion of the previous requests
+        std::mt19937_64 arrivalGenerator(0);
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrival = startTime;
+        auto get_arrival_interval = [&]() {
+            const double seconds =
+                FLAGS_arrival == "poisson" ? poissonIntervals(arrivalGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(nextArrival);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -1004,6 +1039,7 @@ int main(int argc, char* argv[]) {
                 }
             }
 
+            inferRequest->set_iteration(iteration);
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
             } else {
@@ -1014,7 +1050,12 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->start_async();
+                if (openLoop) {
+                    inferRequest->start_async(nextArrival);
+                    nextArrival += get_arrival_interval();
+                } else {
+                    inferRequest->start_async();
+                }
             }
             ++iteration;
 
@@ -1039,6 +1080,17 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.wait_all();
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        LatencyHistogram latencyHistogram;
+        for (auto latency : inferRequestsQueue.get_latencies()) {
+            latencyHistogram.record(latency);
+        }
+        // the latencies measured from the scheduled start include the queueing of the requests
+        LatencyHistogram responseHistogram;
+        if (openLoop) {
+            for (auto latency : inferRequestsQueue.get_response_latencies()) {
+                responseHistogram.record(latency);
+            }
+        }
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1078,6 +1130,12 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           latencyHistogram.to_statistics("Latency", "latency"));
+                if (openLoop) {
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                               responseHistogram.to_statistics("Response latency", "response_latency"));
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1130,12 +1188,44 @@ int main(int argc, char* argv[]) {
         if (statistics)
             statistics->dump();
 
+        if (!FLAGS_latency_csv.empty()) {
+            CsvDumper dumper(true, FLAGS_latency_csv);
+            // the dumper warns and disables itself if the file cannot be created
+            if (dumper.dumpEnabled()) {
+                dumper << "iteration"
+                       << "infer request id"
+                       << "scheduled start (ms)"
+                       << "start (ms)"
+                       << "end (ms)"
+                       << "latency (ms)"
+                       << "response latency (ms)";
+                dumper.endLine();
+                auto to_ms = [&startTime](Time::time_point time) {
+                    return std::chrono::duration_cast<ns>(time - startTime).count() * 0.000001;
+                };
+                for (const auto& timestamps : inferRequestsQueue.get_timestamps()) {
+                    dumper << timestamps.iteration << timestamps.request_id << to_ms(timestamps.scheduled)
+                           << to_ms(timestamps.start) << to_ms(timestamps.end)
+                           << to_ms(timestamps.end) - to_ms(timestamps.start)
+                           << to_ms(timestamps.end) - to_ms(timestamps.scheduled);
+                    dumper.endLine();
+                }
+                slog::info << "Timestamps of the inference requests are stored to " << dumper.getFilename()
+                           << slog::endl;
+            }
+        }
+
         // Performance metrics report
         slog::info << "Count:      " << iteration << " iterations" << slog::endl;
         slog::info << "Duration:   " << double_to_string(totalDuration) << " ms" << slog::endl;
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency: " << slog::endl;
             generalLatency.write_to_slog();
+            latencyHistogram.write_to_slog("Latency distribution:");
+            if (openLoop) {
+                responseHistogram.write_to_slog(
+                    "Response latency distribution (from the scheduled start, coordinated omission corrected):");
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
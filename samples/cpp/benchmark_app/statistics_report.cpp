@@ -4,7 +4,9 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -283,6 +285,89 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     max = latencies.back();
 };
 
+const std::vector<double>& LatencyHistogram::percentiles() {
+    static const std::vector<double> values = {50, 90, 99, 99.9, 99.99};
+    return values;
+}
+
+size_t LatencyHistogram::index_of(uint64_t value) const {
+    // the number of bits of the value, but not less than the bits of the sub-buckets of the first bucket
+    unsigned bits = 0;
+    for (uint64_t v = value | sub_bucket_mask; v != 0; v >>= 1) {
+        bits++;
+    }
+    const unsigned bucket_index = bits - (sub_bucket_half_count_magnitude + 1);
+    const uint64_t sub_bucket_index = value >> bucket_index;
+    return static_cast<size_t>(((static_cast<uint64_t>(bucket_index) + 1) << sub_bucket_half_count_magnitude) +
+                               sub_bucket_index - sub_bucket_half_count);
+}
+
+uint64_t LatencyHistogram::highest_equivalent_value(size_t index) const {
+    int64_t bucket_index = static_cast<int64_t>(index >> sub_bucket_half_count_magnitude) - 1;
+    uint64_t sub_bucket_index = (index & (sub_bucket_half_count - 1)) + sub_bucket_half_count;
+    if (bucket_index < 0) {
+        sub_bucket_index -= sub_bucket_half_count;
+        bucket_index = 0;
+    }
+    return (sub_bucket_index << bucket_index) + (1ull << bucket_index) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const uint64_t value = latency_ms > 0 ? static_cast<uint64_t>(std::llround(latency_ms * 1000000)) : 0;
+    const size_t index = index_of(value);
+    if (counts.size() <= index) {
+        counts.resize(index + 1, 0);
+    }
+    counts[index]++;
+    total_count++;
+    max_ns = std::max(max_ns, value);
+}
+
+double LatencyHistogram::percentile(double percent) const {
+    if (total_count == 0) {
+        return 0;
+    }
+    const uint64_t count_at_percentile =
+        std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * total_count)));
+    uint64_t cumulative = 0;
+    for (size_t index = 0; index < counts.size(); ++index) {
+        cumulative += counts[index];
+        if (cumulative >= count_at_percentile) {
+            return std::min(highest_equivalent_value(index), max_ns) * 0.000001;
+        }
+    }
+    return max();
+}
+
+void LatencyHistogram::write_to_slog(const std::string& title) const {
+    slog::info << title << slog::endl;
+    for (auto percent : percentiles()) {
+        std::ostringstream label;
+        label << "\tP" << percent << ":";
+        // align the values with the other latency metrics
+        auto text = label.str();
+        text.resize(std::max<size_t>(text.size() + 1, 13), ' ');
+        slog::info << text << double_to_string(percentile(percent)) << " ms" << slog::endl;
+    }
+    slog::info << "\tMax:        " << double_to_string(max()) << " ms" << slog::endl;
+}
+
+std::vector<StatisticsVariant> LatencyHistogram::to_statistics(const std::string& csv_prefix,
+                                                              const std::string& json_prefix) const {
+    std::vector<StatisticsVariant> parameters;
+    for (auto percent : percentiles()) {
+        std::ostringstream label;
+        label << percent;
+        auto json_label = label.str();
+        std::replace(json_label.begin(), json_label.end(), '.', '_');
+        parameters.emplace_back(csv_prefix + " P" + label.str() + " (ms)",
+                                json_prefix + "_p" + json_label,
+                                percentile(percent));
+    }
+    parameters.emplace_back(csv_prefix + " max (ms)", json_prefix + "_max", max());
+    return parameters;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
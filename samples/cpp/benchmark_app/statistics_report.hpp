@@ -107,6 +107,42 @@ public:
     void write_to_json(nlohmann::json& js) const;
 };
 
+/// @brief HDR-style latency histogram: log-linear buckets keep 3 significant digits of every recorded value
+/// in the whole range, so the tail percentiles (p99, p99.9) are reported with the bounded relative error
+/// and the memory does not depend on the number of recorded values
+class LatencyHistogram {
+public:
+    void record(double latency_ms);
+
+    /// @brief Returns the value which is not exceeded by the given percent of the recorded values
+    double percentile(double percent) const;
+
+    uint64_t count() const {
+        return total_count;
+    }
+    double max() const {
+        return max_ns * 0.000001;
+    }
+
+    void write_to_slog(const std::string& title) const;
+    std::vector<StatisticsVariant> to_statistics(const std::string& csv_prefix, const std::string& json_prefix) const;
+
+    /// @brief Reported percentiles
+    static const std::vector<double>& percentiles();
+
+private:
+    size_t index_of(uint64_t value) const;
+    uint64_t highest_equivalent_value(size_t index) const;
+
+    static constexpr unsigned sub_bucket_half_count_magnitude = 10;  // 2048 sub-buckets, 3 significant digits
+    static constexpr uint64_t sub_bucket_half_count = 1ull << sub_bucket_half_count_magnitude;
+    static constexpr uint64_t sub_bucket_mask = 2 * sub_bucket_half_count - 1;
+
+    std::vector<uint64_t> counts;
+    uint64_t total_count = 0;
+    uint64_t max_ns = 0;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "statistics_report.hpp"
+
+namespace {
+
+// the buckets keep 3 significant digits: 2048 sub-buckets per power of two
+constexpr double relative_error = 1.0 / 1024;
+
+TEST(LatencyHistogramTest, Empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.max(), 0.0);
+    EXPECT_EQ(histogram.percentile(50), 0.0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    // the values below 2048 ns fall into the unit-wide sub-buckets of the first bucket
+    LatencyHistogram histogram;
+    for (int ns = 1; ns <= 2000; ++ns) {
+        histogram.record(ns * 0.000001);
+    }
+    EXPECT_EQ(histogram.count(), 2000u);
+    EXPECT_DOUBLE_EQ(histogram.percentile(50), 0.001);
+    EXPECT_DOUBLE_EQ(histogram.percentile(90), 0.0018);
+    EXPECT_DOUBLE_EQ(histogram.percentile(100), 0.002);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    // 0.01 ms ... 100 ms with the step of 0.01 ms
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 10000; ++i) {
+        histogram.record(i * 0.01);
+    }
+    EXPECT_EQ(histogram.count(), 10000u);
+    EXPECT_DOUBLE_EQ(histogram.max(), 100.0);
+    for (double percent : {50.0, 90.0, 99.0, 99.9, 99.99}) {
+        const double expected = percent;
+        const double value = histogram.percentile(percent);
+        EXPECT_GE(value, expected) << "P" << percent;
+        EXPECT_LE(value, expected * (1 + relative_error)) << "P" << percent;
+    }
+    EXPECT_DOUBLE_EQ(histogram.percentile(100), 100.0);
+}
+
+TEST(LatencyHistogramTest, PercentileDoesNotExceedMax) {
+    LatencyHistogram histogram;
+    histogram.record(12.3456);
+    EXPECT_DOUBLE_EQ(histogram.percentile(50), 12.3456);
+    EXPECT_DOUBLE_EQ(histogram.percentile(99.99), 12.3456);
+}
+
+TEST(LatencyHistogramTest, BucketRelativeError) {
+    // the value reported for a bucket is its upper bound, which is within the relative error of every value in it
+    for (double latency = 0.000001; latency < 100000; latency *= 1.0137) {
+        LatencyHistogram histogram;
+        histogram.record(latency);
+        histogram.record(latency * 10);
+        const double recorded = std::llround(latency * 1000000) * 0.000001;
+        const double value = histogram.percentile(50);
+        EXPECT_GE(value, recorded) << latency << " ms";
+        EXPECT_LE(value, recorded * (1 + relative_error)) << latency << " ms";
+    }
+}
+
+TEST(LatencyHistogramTest, NegativeLatencyIsRecordedAsZero) {
+    LatencyHistogram histogram;
+    histogram.record(-1.0);
+    EXPECT_EQ(histogram.count(), 1u);
+    EXPECT_EQ(histogram.percentile(50), 0.0);
+}
+
+}  // namespace
@@ -5,13 +5,18 @@
 
 #include <ie_common.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -19,48 +24,201 @@
 
 namespace py = pybind11;
 
+namespace {
+/// \brief Bounded lock-free queue of the request handles (D. Vyukov's MPMC queue).
+/// Every handle is stored in the queue at most once, so the capacity of the pool size never overflows.
+/// The mutex and the condition variable are used only by the threads which wait for the empty queue,
+/// the producers touch them only if somebody waits.
+class HandleQueue {
+public:
+    explicit HandleQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void push(size_t handle) {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto diff = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) -
+                              static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                throw ov::Exception("AsyncInferQueue: the queue of the request handles is full");
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->handle.store(handle, std::memory_order_relaxed);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        notify();
+    }
+
+    bool try_pop(size_t& handle) {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto diff = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) -
+                              static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        handle = cell->handle.load(std::memory_order_relaxed);
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // returns the handle which is popped next without popping it
+    bool try_front(size_t& handle) const {
+        const size_t pos = _dequeue_pos.load(std::memory_order_acquire);
+        const Cell& cell = _cells[pos & _mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        handle = cell.handle.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    // wakes the waiters up to re-check their predicates, must be called after the state they check is changed
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_relaxed) == 0)
+            return;
+        { std::lock_guard<std::mutex> lock(_mutex); }
+        _cv.notify_all();
+    }
+
+    template <typename Predicate>
+    void wait(Predicate predicate) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _waiters.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        _cv.wait(lock, predicate);
+        _waiters.fetch_sub(1);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        std::atomic<size_t> handle;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask;
+    std::atomic<size_t> _enqueue_pos{0};
+    std::atomic<size_t> _dequeue_pos{0};
+    std::atomic<size_t> _waiters{0};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+};
+}  // namespace
+
 class AsyncInferQueue {
 public:
-    AsyncInferQueue(std::vector<InferRequestWrapper> requests,
-                    std::queue<size_t> idle_handles,
-                    std::vector<py::object> user_ids)
+    AsyncInferQueue(std::vector<InferRequestWrapper> requests, std::vector<py::object> user_ids)
         : _requests(requests),
-          _idle_handles(idle_handles),
+          _idle_handles(requests.size()),
+          _completed_handles(requests.size()),
           _user_ids(user_ids) {
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _idle_handles.push(handle);
+        }
         this->set_default_callbacks();
     }
 
     ~AsyncInferQueue() {
+        {
+            // the dispatcher needs GIL to deliver the completed requests
+            py::gil_scoped_release release;
+            for (auto&& request : _requests) {
+                request._request.wait();
+            }
+            if (_dispatcher.joinable()) {
+                _idle_handles.wait([this] {
+                    return _undelivered.load() == 0;
+                });
+                _stop = true;
+                _completed_handles.notify();
+                _dispatcher.join();
+            }
+        }
         _requests.clear();
     }
 
+    void check_errors() {
+        if (!_has_errors.load(std::memory_order_acquire))
+            return;
+        // acquire the mutex to access _errors
+        std::lock_guard<std::mutex> lock(_errors_mutex);
+        throw _errors.front();
+    }
+
     bool _is_ready() {
         // Check if any request has finished already
-        py::gil_scoped_release release;
-        // acquire the mutex to access _errors and _idle_handles
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_errors.size() > 0)
-            throw _errors.front();
-        return !(_idle_handles.empty());
+        check_errors();
+        size_t handle;
+        return _idle_handles.try_front(handle);
     }
 
     size_t get_idle_request_id() {
         // Wait for any request to complete and return its id
-        // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        // acquire the mutex to access _errors and _idle_handles
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return !(_idle_handles.empty());
-        });
-        size_t idle_handle = _idle_handles.front();
+        size_t idle_handle;
+        if (!_idle_handles.try_front(idle_handle)) {
+            // release GIL to avoid deadlock on python callback
+            py::gil_scoped_release release;
+            _idle_handles.wait([&] {
+                return _idle_handles.try_front(idle_handle);
+            });
+        }
+        // wait for request to make sure it returned from callback
+        _requests[idle_handle]._request.wait();
+        check_errors();
+        return idle_handle;
+    }
+
+    size_t pop_idle_request_id() {
+        // Wait for any request to complete and take it from the idle ones,
+        // neither the lock is taken nor GIL is released if there is an idle request already
+        size_t idle_handle;
+        if (!_idle_handles.try_pop(idle_handle)) {
+            // release GIL to avoid deadlock on python callback
+            py::gil_scoped_release release;
+            _idle_handles.wait([&] {
+                return _idle_handles.try_pop(idle_handle);
+            });
+        }
         // wait for request to make sure it returned from callback
         _requests[idle_handle]._request.wait();
-        if (_errors.size() > 0)
-            throw _errors.front();
+        try {
+            check_errors();
+        } catch (...) {
+            _idle_handles.push(idle_handle);
+            throw;
+        }
         return idle_handle;
     }
 
+    void release_request_id(size_t handle) {
+        // Add idle handle to queue, notifies the waiters in get_idle_request_id() and pop_idle_request_id()
+        _idle_handles.push(handle);
+    }
+
     void wait_all() {
         // Wait for all request to complete
         // release GIL to avoid deadlock on python callback
@@ -68,10 +226,18 @@ public:
         for (auto&& request : _requests) {
             request._request.wait();
         }
+        // the batched callbacks are invoked by the dispatcher after the requests are completed
+        _idle_handles.wait([this] {
+            return _undelivered.load() == 0;
+        });
+        check_errors();
+    }
+
+    void add_error(const py::error_already_set& py_error) {
         // acquire the mutex to access _errors
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_errors.size() > 0)
-            throw _errors.front();
+        std::lock_guard<std::mutex> lock(_errors_mutex);
+        _errors.push(py_error);
+        _has_errors.store(true, std::memory_order_release);
     }
 
     void set_default_callbacks() {
@@ -85,14 +251,7 @@ public:
                 } catch (const std::exception& e) {
                     throw ov::Exception(e.what());
                 }
-                {
-                    // acquire the mutex to access _idle_handles
-                    std::lock_guard<std::mutex> lock(_mutex);
-                    // Add idle handle to queue
-                    _idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                _cv.notify_one();
+                release_request_id(handle);
             });
         }
     }
@@ -108,34 +267,138 @@ public:
                 } catch (const std::exception& e) {
                     throw ov::Exception(e.what());
                 }
-                // Acquire GIL, execute Python function
+                {
+                    // Acquire GIL, execute Python function
+                    py::gil_scoped_acquire acquire;
+                    try {
+                        f_callback(_requests[handle], _user_ids[handle]);
+                    } catch (py::error_already_set py_error) {
+                        assert(PyErr_Occurred());
+                        add_error(py_error);
+                    }
+                }
+                release_request_id(handle);
+            });
+        }
+    }
+
+    void set_batched_callbacks(py::function f_callback, size_t max_batch_size) {
+        {
+            py::gil_scoped_release release;
+            for (auto&& request : _requests) {
+                request._request.wait();
+            }
+            // the dispatcher may still deliver the last batch with the previous callback
+            _idle_handles.wait([this] {
+                return _undelivered.load() == 0;
+            });
+        }
+        {
+            // GIL is taken before the mutex here and in the dispatcher
+            std::lock_guard<std::mutex> lock(_callback_mutex);
+            _batched_callback = f_callback;
+            _max_batch_size = max_batch_size == 0 ? _requests.size() : max_batch_size;
+        }
+        if (!_dispatcher.joinable()) {
+            _dispatcher = std::thread([this] {
+                dispatch_completed_requests();
+            });
+        }
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _requests[handle]._request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                _requests[handle]._end_time = Time::now();
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    throw ov::Exception(e.what());
+                }
+                // GIL is not taken here, the request is handed over to the dispatcher
+                _undelivered.fetch_add(1);
+                _completed_handles.push(handle);
+            });
+        }
+    }
+
+    // zero-copy views of the output tensors of the request, valid until the request is started again
+    py::list get_output_views(size_t handle) {
+        py::list views;
+        for (auto&& tensor : _requests[handle].get_output_tensors()) {
+            views.append(py::array(Common::ov_type_to_dtype().at(tensor.get_element_type()),
+                                   tensor.get_shape(),
+                                   tensor.get_strides(),
+                                   tensor.data(),
+                                   py::cast(tensor)));
+        }
+        return views;
+    }
+
+    void dispatch_completed_requests() {
+        std::vector<size_t> batch;
+        for (;;) {
+            size_t handle;
+            _completed_handles.wait([&] {
+                return _stop.load() || _completed_handles.try_pop(handle);
+            });
+            if (_stop.load())
+                return;
+            size_t max_batch_size = 0;
+            {
+                std::lock_guard<std::mutex> lock(_callback_mutex);
+                max_batch_size = _max_batch_size;
+            }
+            batch.clear();
+            batch.push_back(handle);
+            while (batch.size() < max_batch_size && _completed_handles.try_pop(handle)) {
+                batch.push_back(handle);
+            }
+            {
+                // Acquire GIL once for the whole batch, execute Python function
                 py::gil_scoped_acquire acquire;
                 try {
-                    f_callback(_requests[handle], _user_ids[handle]);
+                    py::function callback;
+                    {
+                        std::lock_guard<std::mutex> lock(_callback_mutex);
+                        callback = _batched_callback;
+                    }
+                    py::list completed;
+                    for (auto&& completed_handle : batch) {
+                        completed.append(py::make_tuple(completed_handle,
+                                                        _user_ids[completed_handle],
+                                                        get_output_views(completed_handle)));
+                    }
+                    callback(completed);
                 } catch (py::error_already_set py_error) {
-                    assert(PyErr_Occurred());
-                    // acquire the mutex to access _errors
-                    std::lock_guard<std::mutex> lock(_mutex);
-                    _errors.push(py_error);
-                }
-                {
-                    // acquire the mutex to access _idle_handles
-                    std::lock_guard<std::mutex> lock(_mutex);
-                    // Add idle handle to queue
-                    _idle_handles.push(handle);
+                    add_error(py_error);
+                } catch (const std::exception& e) {
+                    // the exception must not leave the dispatcher thread, it is rethrown to the user as Python one
+                    PyErr_SetString(PyExc_RuntimeError, e.what());
+                    add_error(py::error_already_set());
                 }
-                // Notify locks in getIdleRequestId()
-                _cv.notify_one();
-            });
+            }
+            _undelivered.fetch_sub(batch.size());
+            for (auto&& completed_handle : batch) {
+                release_request_id(completed_handle);
+            }
         }
     }
 
     std::vector<InferRequestWrapper> _requests;
-    std::queue<size_t> _idle_handles;
+    HandleQueue _idle_handles;
+    HandleQueue _completed_handles;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
-    std::mutex _mutex;
-    std::condition_variable _cv;
+    std::mutex _errors_mutex;
+    std::atomic<bool> _has_errors{false};
     std::queue<py::error_already_set> _errors;
+
+    // guards the batched callback and the maximal batch size, which are read by the dispatcher
+    std::mutex _callback_mutex;
+    py::function _batched_callback;
+    size_t _max_batch_size = 0;
+    std::atomic<size_t> _undelivered{0};
+    std::atomic<bool> _stop{false};
+    std::thread _dispatcher;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -149,7 +412,6 @@ void regclass_AsyncInferQueue(py::module m) {
                 }
 
                 std::vector<InferRequestWrapper> requests;
-                std::queue<size_t> idle_handles;
                 std::vector<py::object> user_ids(jobs);
 
                 for (size_t handle = 0; handle < jobs; handle++) {
@@ -159,10 +421,9 @@ void regclass_AsyncInferQueue(py::module m) {
                     request._outputs = model.outputs();
 
                     requests.push_back(request);
-                    idle_handles.push(handle);
                 }
 
-                return new AsyncInferQueue(requests, idle_handles, user_ids);
+                return new AsyncInferQueue(requests, user_ids);
             }),
             py::arg("model"),
             py::arg("jobs") = 0,
@@ -180,17 +441,18 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const py::dict inputs, py::object userdata) {
-            // getIdleRequestId function has an intention to block InferQueue
+            // pop_idle_request_id function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self._mutex);
-                self._idle_handles.pop();
+            auto handle = self.pop_idle_request_id();
+            try {
+                // Set new inputs label/id from user
+                self._user_ids[handle] = userdata;
+                // Update inputs if there are any
+                Common::set_request_tensors(self._requests[handle]._request, inputs);
+            } catch (...) {
+                self.release_request_id(handle);
+                throw;
             }
-            // Set new inputs label/id from user
-            self._user_ids[handle] = userdata;
-            // Update inputs if there are any
-            Common::set_request_tensors(self._requests[handle]._request, inputs);
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
@@ -278,6 +540,41 @@ void regclass_AsyncInferQueue(py::module m) {
         :type callback: function
     )");
 
+    cls.def(
+        "set_batched_callback",
+        [](AsyncInferQueue& self, py::function callback, size_t max_batch_size) {
+            self.set_batched_callbacks(callback, max_batch_size);
+        },
+        py::arg("callback"),
+        py::arg("max_batch_size") = 0,
+        R"(
+        Sets callback which is invoked once for a batch of completed InferRequests.
+
+        Completions do not acquire the GIL, the completed requests are collected
+        and passed to the callback by a single dispatching thread, which takes
+        the GIL once per batch. The batch contains all the requests completed
+        since the previous invocation, but not more than max_batch_size.
+        The only argument of the callback is a list of tuples
+        (request_id, userdata, outputs), where outputs is a list of numpy arrays
+        sharing the memory with the output tensors of the request. These arrays
+        are valid only until the request is started again, so they should be
+        copied if needed after the callback returns.
+
+        .. code-block:: python
+
+            def f(completed):
+                for request_id, userdata, outputs in completed:
+                    results[userdata] = outputs[0].copy()
+
+            async_infer_queue.set_batched_callback(f)
+
+        :param callback: Any Python defined function that matches callback's requirements.
+        :type callback: function
+        :param max_batch_size: Maximal number of requests passed to a single callback
+        invocation. If 0, the number of InferRequests in a pool is used. Default: 0
+        :type max_batch_size: int
+    )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
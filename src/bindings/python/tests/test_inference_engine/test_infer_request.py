@@ -427,6 +427,84 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+def test_infer_queue_batched_callback(device):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, num_request)
+    results = [None] * jobs
+    batch_sizes = []
+
+    def callback(completed):
+        batch_sizes.append(len(completed))
+        for request_id, job_id, outputs in completed:
+            assert 0 <= request_id < num_request
+            assert isinstance(outputs[0], np.ndarray)
+            results[job_id] = outputs[0].copy()
+
+    infer_queue.set_batched_callback(callback, max_batch_size=2)
+    for i in range(jobs):
+        infer_queue.start_async({0: np.full([10], i - jobs // 2, dtype=np.float32)}, i)
+    infer_queue.wait_all()
+
+    assert sum(batch_sizes) == jobs
+    assert max(batch_sizes) <= 2
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.full([10], max(i - jobs // 2, 0), dtype=np.float32))
+
+
+def test_infer_queue_replace_batched_callback(device):
+    jobs = 16
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 4)
+    first_jobs = []
+    second_jobs = []
+
+    def first_callback(completed):
+        first_jobs.extend(job_id for _, job_id, _ in completed)
+
+    def second_callback(completed):
+        assert len(completed) == 1
+        second_jobs.extend(job_id for _, job_id, _ in completed)
+
+    infer_queue.set_batched_callback(first_callback, max_batch_size=3)
+    for i in range(jobs):
+        infer_queue.start_async({0: np.zeros([10], dtype=np.float32)}, i)
+    # the requests in flight are delivered to the previous callback before it is replaced
+    infer_queue.set_batched_callback(second_callback, max_batch_size=1)
+    assert sorted(first_jobs) == list(range(jobs))
+
+    for i in range(jobs, 2 * jobs):
+        infer_queue.start_async({0: np.zeros([10], dtype=np.float32)}, i)
+    infer_queue.wait_all()
+    assert sorted(first_jobs) == list(range(jobs))
+    assert sorted(second_jobs) == list(range(jobs, 2 * jobs))
+
+
+def test_infer_queue_batched_callback_fail(device):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 2)
+
+    def callback(completed):
+        raise ValueError("batched callback error")
+
+    infer_queue.set_batched_callback(callback)
+    with pytest.raises(ValueError) as e:
+        infer_queue.start_async({0: np.zeros([10], dtype=np.float32)})
+        infer_queue.wait_all()
+
+    assert "batched callback error" in str(e.value)
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
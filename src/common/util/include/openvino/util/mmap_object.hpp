@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only mapping of the whole file into the memory
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns the start of the mapped file, nullptr for an empty file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns the size of the mapped file in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into the memory for reading
+ * @param path Path to the file
+ * @return Mapping of the file, the file is unmapped when the last reference to it is destroyed
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char path into the memory for reading
+ * @param path Path to the file
+ * @return Mapping of the file, the file is unmapped when the last reference to it is destroyed
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -7,9 +7,11 @@
 #include <atomic>
 #include <initializer_list>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/core/core_visibility.hpp"
@@ -341,10 +343,14 @@ private:
     ov::op::util::VariableVector m_variables;
     RTMap m_rt_info;
 
-    // Cache of topologically sorted nodes which is stored as a vector
-    // of weak_ptr not to increase node ref counter to prevent the situation when
-    // node has no consumers but still exists in a graph.
-    mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+    // Cache of topologically sorted nodes which is stored as weak_ptr
+    // not to increase node ref counter to prevent the situation when
+    // node has no consumers but still exists in a graph. The nodes are ordered
+    // by sparse keys, so the order is updated in place when the graph changes.
+    mutable std::map<uint64_t, std::weak_ptr<Node>> m_cached_ordered_ops;
+    mutable std::unordered_map<const Node*, uint64_t> m_cached_op_keys;
+    // The cached order can be updated incrementally only for the default sorter
+    bool m_use_default_topological_sorter{true};
 
     // Private runtime info which is shared across nodes and used only
     // for internal purposes.
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cfenv>
 #include <cmath>
@@ -16,6 +17,7 @@
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph {
@@ -54,6 +56,13 @@ constexpr inline bool in_range(Int val, std::pair<Int, Int> range) noexcept {
     return val >= range.first && val < range.second;
 }
 
+// The range [first, second) of the filter positions which hit the input (not the padding) for the input position i.
+inline std::pair<int, int> get_filter_range(int i, int dilation, int filter_size, int input_size) {
+    const int begin = i < 0 ? (-i + dilation - 1) / dilation : 0;
+    const int end = input_size - i <= 0 ? 0 : std::min(filter_size, (input_size - i + dilation - 1) / dilation);
+    return {begin, std::max(begin, end)};
+}
+
 template <typename T>
 void convolve_3D_channels(const ConvolutionParams& p,
                           const T* batch,
@@ -85,29 +94,27 @@ void convolve_3D_channels(const ConvolutionParams& p,
             for (int i_x = -p.pads_begin[2];
                  i_x <= (p.pads_end[2] + input_size_x - dilated_filter_size_x + p.output_padding[2]);
                  i_x += p.strides[2]) {
+                // the filter positions hitting the padding are skipped in advance, so the inner loop is branchless
+                // and the accumulation order is the same as for the whole filter with the padding checks
+                const auto f_z_range = get_filter_range(i_z, p.dilation[0], filter_size_z, input_size_z);
+                const auto f_y_range = get_filter_range(i_y, p.dilation[1], filter_size_y, input_size_y);
+                const auto f_x_range = get_filter_range(i_x, p.dilation[2], filter_size_x, input_size_x);
+
                 auto input_channel = batch;
                 auto filter_channel = filter;
                 T sum = 0;
                 size_t filter_channels_count = filter_shape[0];
                 while (filter_channels_count--) {
-                    for (int f_z = 0; f_z < filter_size_z; ++f_z) {
-                        for (int f_y = 0; f_y < filter_size_y; ++f_y) {
-                            for (int f_x = 0; f_x < filter_size_x; ++f_x) {
-                                int rel_i_z = i_z + (f_z * p.dilation[0]);
-                                int rel_i_y = i_y + (f_y * p.dilation[1]);
-                                int rel_i_x = i_x + (f_x * p.dilation[2]);
-
-                                bool padding =
-                                    !(in_range(rel_i_x, {0, input_size_x}) && in_range(rel_i_y, {0, input_size_y}) &&
-                                      in_range(rel_i_z, {0, input_size_z}));
-                                if (padding)
-                                    continue;
-
-                                int f_buf_idx = (f_z * filter_size_y * filter_size_x) + (f_y * filter_size_x) + f_x;
-                                int i_buf_idx =
-                                    (rel_i_z * input_size_y * input_size_x) + (rel_i_y * input_size_x) + rel_i_x;
-                                sum += static_cast<T>(input_channel[i_buf_idx]) *
-                                       static_cast<T>(filter_channel[f_buf_idx]);
+                    for (int f_z = f_z_range.first; f_z < f_z_range.second; ++f_z) {
+                        const int rel_i_z = i_z + (f_z * p.dilation[0]);
+                        for (int f_y = f_y_range.first; f_y < f_y_range.second; ++f_y) {
+                            const int rel_i_y = i_y + (f_y * p.dilation[1]);
+                            const int i_row_idx =
+                                (rel_i_z * input_size_y * input_size_x) + (rel_i_y * input_size_x) + i_x;
+                            const int f_row_idx = (f_z * filter_size_y * filter_size_x) + (f_y * filter_size_x);
+                            for (int f_x = f_x_range.first; f_x < f_x_range.second; ++f_x) {
+                                sum += static_cast<T>(input_channel[i_row_idx + f_x * p.dilation[2]]) *
+                                       static_cast<T>(filter_channel[f_row_idx + f_x]);
                             }
                         }
                     }
@@ -234,15 +241,24 @@ void convolution(const T* in,
     const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
     const size_t filter_size = shape_size(filter_shape);
 
-    auto batch = in;
-    for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx) {
-        auto filter = f;
-        for (size_t f_idx = 0; f_idx < filters_count; ++f_idx) {
-            convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-            filter += filter_size;
-        }
-        batch += batch_size;
-    }
+    // the output channels of all the batches are computed independently of each other
+    const size_t out_channels_count = batches_count * filters_count;
+    if (out_channels_count == 0)
+        return;
+    const size_t out_channel_size = shape_size(out_shape) / out_channels_count;
+    // the minimal number of the multiply-add operations per thread
+    const size_t min_work_per_thread = 1 << 16;
+    const size_t out_channel_work = std::max<size_t>(1, out_channel_size * filter_size);
+    parallel_for_chunks(out_channels_count,
+                        std::max<size_t>(1, min_work_per_thread / out_channel_work),
+                        [&](size_t begin, size_t end) {
+                            for (size_t idx = begin; idx < end; ++idx) {
+                                const auto batch = in + (idx / filters_count) * batch_size;
+                                const auto filter = f + (idx % filters_count) * filter_size;
+                                auto out_channel = out + idx * out_channel_size;
+                                convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out_channel);
+                            }
+                        });
 }
 }  // namespace reference
 }  // namespace runtime
@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+// Computes the complex-to-real inverse DFT of 'input_data' of the shape [..., 2] along the canonical 'axes_data'.
+// The input is trimmed or padded to 'output_shape' along the axes, except the last of the axes where it is trimmed or
+// padded to output_shape[axes_data.back()] / 2 + 1 elements, as the rest of the spectrum is defined by the conjugate
+// symmetry.
+void irdft(const float* input_data,
+           const Shape& input_data_shape,
+           const std::vector<int64_t>& axes_data,
+           float* irdft_result,
+           const Shape& output_shape);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
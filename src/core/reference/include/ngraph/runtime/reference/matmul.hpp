@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -11,12 +12,89 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace details {
+// Computes the rows [i_begin, i_end) of the {I, K} x {K, J} product. The loops are blocked for the cache and the inner
+// loop is contiguous, so it is vectorized by the compiler. Every output element is still accumulated in the ascending
+// order of k, so the results are identical to the plain i-k-j loop for all the types.
+template <typename T>
+void dot_rows(const T* arg0, const T* arg1, T* out, size_t K_dim, size_t J_dim, size_t i_begin, size_t i_end) {
+    const size_t block_i = 16;
+    const size_t block_k = 128;
+    const size_t block_j = 512;
+
+    std::fill(out + i_begin * J_dim, out + i_end * J_dim, T{0});
+    for (size_t ib = i_begin; ib < i_end; ib += block_i) {
+        const size_t ie = std::min(ib + block_i, i_end);
+        for (size_t kb = 0; kb < K_dim; kb += block_k) {
+            const size_t ke = std::min(kb + block_k, K_dim);
+            for (size_t jb = 0; jb < J_dim; jb += block_j) {
+                const size_t je = std::min(jb + block_j, J_dim);
+                for (size_t i = ib; i < ie; ++i) {
+                    T* out_row = out + i * J_dim;
+                    for (size_t k = kb; k < ke; ++k) {
+                        const T a = arg0[i * K_dim + k];
+                        const T* arg1_row = arg1 + k * J_dim;
+                        for (size_t j = jb; j < je; ++j) {
+                            out_row[j] += a * arg1_row[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Computes batch_size products of {I, K} x {K, J} matrices, the output rows of all the batches are distributed between
+// the threads
+template <typename T>
+void batched_dot(const T* arg0,
+                 const T* arg1,
+                 T* out,
+                 size_t batch_size,
+                 size_t arg0_offset,
+                 size_t arg1_offset,
+                 size_t out_offset,
+                 size_t I_dim,
+                 size_t K_dim,
+                 size_t J_dim) {
+    // the minimal number of the multiply-add operations per thread
+    const size_t min_work_per_thread = 1 << 16;
+    const size_t min_rows_per_thread = std::max<size_t>(1, min_work_per_thread / std::max<size_t>(1, K_dim * J_dim));
+
+    parallel_for_chunks(batch_size * I_dim, min_rows_per_thread, [&](size_t begin, size_t end) {
+        while (begin < end) {
+            const size_t batch = begin / I_dim;
+            const size_t i_begin = begin % I_dim;
+            const size_t i_end = std::min(I_dim, i_begin + (end - begin));
+            dot_rows(arg0 + batch * arg0_offset,
+                     arg1 + batch * arg1_offset,
+                     out + batch * out_offset,
+                     K_dim,
+                     J_dim,
+                     i_begin,
+                     i_end);
+            begin += i_end - i_begin;
+        }
+    });
+}
+
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline void get_dot_dims(const Shape& arg0_shape, const Shape& arg1_shape, size_t& I_dim, size_t& K_dim, size_t& J_dim) {
+    const size_t arg0_rank = arg0_shape.size();
+    const size_t arg1_rank = arg1_shape.size();
+    I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
+    J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
+    K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+}
+
 template <typename T>
 void dot(const T* arg0,
          const T* arg1,
@@ -24,27 +102,9 @@ void dot(const T* arg0,
          const Shape& arg0_shape,
          const Shape& arg1_shape,
          const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
-    const size_t arg0_rank = arg0_shape.size();
-    const size_t arg1_rank = arg1_shape.size();
-
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-    const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
-            }
-        }
-    }
+    size_t I_dim, K_dim, J_dim;
+    get_dot_dims(arg0_shape, arg1_shape, I_dim, K_dim, J_dim);
+    batched_dot(arg0, arg1, out, 1, 0, 0, 0, I_dim, K_dim, J_dim);
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +268,18 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    size_t I_dim, K_dim, J_dim;
+    details::get_dot_dims(dot_arg0_shape, dot_arg1_shape, I_dim, K_dim, J_dim);
+    details::batched_dot(arg0_data,
+                         arg1_data,
+                         out,
+                         output_batch_size,
+                         arg0_offset,
+                         arg1_offset,
+                         output_offset,
+                         I_dim,
+                         K_dim,
+                         J_dim);
 }
 }  // namespace reference
 }  // namespace runtime
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+// Computes the real-to-complex DFT of 'input_data' along the canonical 'axes_data'.
+// 'output_fft_shape' is the complex shape [..., 2] of the full spectrum, that is the input shape with the signal sizes
+// applied. The result keeps only output_fft_shape[axes_data.back()] / 2 + 1 elements along the last of the axes.
+void rdft(const float* input_data,
+          const Shape& input_data_shape,
+          const std::vector<int64_t>& axes_data,
+          const Shape& output_fft_shape,
+          float* rdft_result);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Splits the range [0, work_amount) into contiguous chunks of at least min_chunk_size items
+///        and calls body(begin, end) for the chunks concurrently. The chunks are run by the threading
+///        runtime OpenVINO is built with (TBB, OpenMP or sequentially) within the arena of the caller,
+///        so the calls made by the streams of a plugin respect their threads and don't oversubscribe
+///        the CPU.
+///
+/// \param work_amount Number of the work items.
+/// \param min_chunk_size Minimal number of the work items processed by one thread.
+/// \param body Callable processing the work items in [begin, end).
+/// \param max_threads Maximal number of the chunks run concurrently, 0 means the concurrency of the
+///        caller's arena.
+void parallel_for_chunks(size_t work_amount,
+                         size_t min_chunk_size,
+                         const std::function<void(size_t begin, size_t end)>& body,
+                         size_t max_threads = 0);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
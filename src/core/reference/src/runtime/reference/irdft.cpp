@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/irdft.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <functional>
+#include <numeric>
+
+#include "ngraph/runtime/reference/fft.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+using complex_type = std::complex<float>;
+
+// Copies the common part of the tensors, the rest of the output is filled with zeros
+void resize(const float* input_data, const Shape& input_shape, float* output_data, const Shape& output_shape) {
+    const auto input_strides = row_major_strides(input_shape);
+    const auto output_strides = row_major_strides(output_shape);
+    const size_t output_size = shape_size(output_shape);
+    std::fill_n(output_data, output_size, 0.0f);
+
+    for (size_t i = 0; i < output_size; ++i) {
+        size_t input_offset = 0;
+        size_t rest = i;
+        bool inside = true;
+        for (size_t axis = 0; axis < output_shape.size() && inside; ++axis) {
+            const size_t coord = rest / output_strides[axis];
+            rest %= output_strides[axis];
+            inside = coord < input_shape[axis];
+            input_offset += coord * input_strides[axis];
+        }
+        if (inside) {
+            output_data[i] = input_data[input_offset];
+        }
+    }
+}
+}  // namespace
+
+void irdft(const float* input_data,
+           const Shape& input_data_shape,
+           const std::vector<int64_t>& axes_data,
+           float* irdft_result,
+           const Shape& output_shape) {
+    const size_t output_size = shape_size(output_shape);
+    if (output_size == 0) {
+        return;
+    }
+
+    const auto last_axis = static_cast<size_t>(axes_data.back());
+    const size_t length = output_shape[last_axis];
+    const size_t half_length = length / 2 + 1;
+
+    Shape half_shape = output_shape;
+    half_shape[last_axis] = half_length;
+    half_shape.push_back(2);
+    std::vector<float> half_spectrum(shape_size(half_shape));
+    resize(input_data, input_data_shape, half_spectrum.data(), half_shape);
+
+    if (axes_data.size() > 1) {
+        const std::vector<int64_t> outer_axes(axes_data.begin(), axes_data.end() - 1);
+        std::vector<float> fft_result(half_spectrum.size());
+        fft(half_spectrum.data(),
+            half_shape,
+            outer_axes.data(),
+            Shape{outer_axes.size()},
+            fft_result.data(),
+            half_shape,
+            FFTKind::Inverse);
+        half_spectrum.swap(fft_result);
+    }
+
+    // The rest of the spectrum along the last of the axes is restored from the conjugate symmetry
+    const size_t outer_size = std::accumulate(output_shape.begin(),
+                                              output_shape.begin() + last_axis,
+                                              size_t(1),
+                                              std::multiplies<size_t>());
+    const size_t inner_size = output_size / (outer_size * length);
+    const auto* half_data = reinterpret_cast<const complex_type*>(half_spectrum.data());
+    std::vector<complex_type> spectrum(output_size);
+    for (size_t i = 0; i < outer_size; ++i) {
+        for (size_t k = 0; k < length; ++k) {
+            for (size_t j = 0; j < inner_size; ++j) {
+                spectrum[(i * length + k) * inner_size + j] =
+                    k < half_length ? half_data[(i * half_length + k) * inner_size + j]
+                                    : std::conj(half_data[(i * half_length + length - k) * inner_size + j]);
+            }
+        }
+    }
+
+    Shape spectrum_shape = output_shape;
+    spectrum_shape.push_back(2);
+    const int64_t fft_axis = static_cast<int64_t>(last_axis);
+    std::vector<complex_type> fft_result(output_size);
+    fft(reinterpret_cast<const float*>(spectrum.data()),
+        spectrum_shape,
+        &fft_axis,
+        Shape{1},
+        reinterpret_cast<float*>(fft_result.data()),
+        spectrum_shape,
+        FFTKind::Inverse);
+
+    for (size_t i = 0; i < output_size; ++i) {
+        irdft_result[i] = fft_result[i].real();
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/rdft.hpp"
+
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include "ngraph/runtime/reference/fft.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+void rdft(const float* input_data,
+          const Shape& input_data_shape,
+          const std::vector<int64_t>& axes_data,
+          const Shape& output_fft_shape,
+          float* rdft_result) {
+    if (shape_size(output_fft_shape) == 0) {
+        return;
+    }
+
+    // The real input is transformed as the complex one with zero imaginary parts
+    const size_t input_size = shape_size(input_data_shape);
+    std::vector<float> complex_input(2 * input_size, 0.0f);
+    for (size_t i = 0; i < input_size; ++i) {
+        complex_input[2 * i] = input_data[i];
+    }
+    Shape complex_input_shape = input_data_shape;
+    complex_input_shape.push_back(2);
+
+    std::vector<float> fft_result(shape_size(output_fft_shape));
+    fft(complex_input.data(),
+        complex_input_shape,
+        axes_data.data(),
+        Shape{axes_data.size()},
+        fft_result.data(),
+        output_fft_shape,
+        FFTKind::Forward);
+
+    // Only the first half of the spectrum is kept along the last of the axes
+    const auto last_axis = static_cast<size_t>(axes_data.back());
+    const size_t outer_size = std::accumulate(output_fft_shape.begin(),
+                                              output_fft_shape.begin() + last_axis,
+                                              size_t(1),
+                                              std::multiplies<size_t>());
+    const size_t inner_size = std::accumulate(output_fft_shape.begin() + last_axis + 1,
+                                              output_fft_shape.end(),
+                                              size_t(1),
+                                              std::multiplies<size_t>());
+    const size_t length = output_fft_shape[last_axis];
+    const size_t half_length = length / 2 + 1;
+    for (size_t i = 0; i < outer_size; ++i) {
+        std::memcpy(rdft_result + i * half_length * inner_size,
+                    fft_result.data() + i * length * inner_size,
+                    half_length * inner_size * sizeof(float));
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
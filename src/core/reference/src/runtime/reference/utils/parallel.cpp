@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+void parallel_for_chunks(size_t work_amount,
+                         size_t min_chunk_size,
+                         const std::function<void(size_t begin, size_t end)>& body,
+                         size_t max_threads) {
+    if (work_amount == 0)
+        return;
+
+    // the concurrency of the caller's arena (OpenMP team), so the calls made by the streams of a plugin stay
+    // within the threads of the streams
+    const size_t max_chunks = std::max<size_t>(1, work_amount / std::max<size_t>(1, min_chunk_size));
+    size_t chunks = std::min(max_chunks, static_cast<size_t>(std::max(1, parallel_get_max_threads())));
+    if (max_threads != 0)
+        chunks = std::min(chunks, max_threads);
+    if (chunks == 1) {
+        body(0, work_amount);
+        return;
+    }
+
+    // the exceptions are not propagated out of the OpenMP parallel regions
+    std::vector<std::exception_ptr> errors(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t chunk) {
+        try {
+            body(work_amount * chunk / chunks, work_amount * (chunk + 1) / chunks);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -37,15 +37,23 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     }
     new_output.add_input(this);
     m_output = &new_output;
-    m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
 
-    // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
-    for_each(m_node->m_shared_rt_info.cbegin(),
-             m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
-             });
+    // Output replacement may change the topological order of nodes, so the change is recorded
+    // into shared node info of the models which contain the consumer or the old producer, they
+    // update the cached order on the next request.
+    Node* old_producer = m_src_node.get();
+    for (const auto& info : m_node->m_shared_rt_info) {
+        info->record_replaced_input(m_node, old_producer);
+    }
+    if (old_producer) {
+        for (const auto& info : old_producer->m_shared_rt_info) {
+            if (!m_node->m_shared_rt_info.count(info)) {
+                info->record_replaced_input(m_node, old_producer);
+            }
+        }
+    }
+
+    m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
@@ -3,10 +3,13 @@
 //
 
 #include <algorithm>
+#include <limits>
 #include <list>
 #include <memory>
+#include <queue>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
@@ -75,6 +78,346 @@ ov::op::util::VariableVector auto_detect_variables(const std::vector<std::shared
     return ov::op::util::VariableVector(variables.begin(), variables.end());
 }
 
+// Keys of the cached topological order are sparse, so new nodes are inserted
+// between the existing ones without renumbering the whole order
+constexpr uint64_t order_key_stride = uint64_t{1} << 32;
+
+using OrderedOps = std::map<uint64_t, std::weak_ptr<ov::Node>>;
+using OrderKeys = std::unordered_map<const ov::Node*, uint64_t>;
+
+template <typename F>
+void for_each_dependency(ov::Node* node, const F& f) {
+    for (size_t i = 0; i < node->get_input_size(); ++i) {
+        f(node->get_input_node_ptr(i));
+    }
+    for (const auto& dependency : node->get_control_dependencies()) {
+        f(dependency.get());
+    }
+}
+
+template <typename F>
+void for_each_dependent(ov::Node* node, const F& f) {
+    for (const auto& output : node->outputs()) {
+        for (const auto& input : output.get_target_inputs()) {
+            f(input.get_node());
+        }
+    }
+    for (const auto& dependent : node->get_control_dependents()) {
+        f(dependent);
+    }
+}
+
+/// \brief Applies the recorded input replacements to the cached topological order of the model.
+///
+/// New nodes are inserted before their consumers, the nodes which are not reachable anymore
+/// are dropped, and the order of the affected regions is restored with the Pearce-Kelly
+/// dynamic topological sort. So the cost depends on the size of the change rather than on
+/// the size of the model.
+class TopologicalOrderUpdater {
+public:
+    TopologicalOrderUpdater(const ov::Model& model, OrderedOps& order, OrderKeys& keys)
+        : m_model(model),
+          m_order(order),
+          m_keys(keys) {}
+
+    /// \return false if the order can't be updated and has to be rebuilt from scratch
+    bool update(const ov::SharedRTInfo::ReplacedInputs& replaced_inputs) {
+        // the nodes of the order whose inputs were replaced and the nodes which lost a consumer
+        std::vector<std::shared_ptr<ov::Node>> consumers;
+        std::priority_queue<std::pair<uint64_t, std::shared_ptr<ov::Node>>> candidates;
+        std::unordered_set<const ov::Node*> visited_consumers;
+        uint64_t key = 0;
+        for (const auto& replaced_input : replaced_inputs) {
+            if (replaced_input.first && visited_consumers.insert(replaced_input.first).second) {
+                if (auto consumer = find(replaced_input.first, key)) {
+                    consumers.push_back(consumer);
+                }
+            }
+            if (replaced_input.second) {
+                if (auto producer = find(replaced_input.second, key)) {
+                    candidates.emplace(key, producer);
+                }
+            }
+        }
+
+        // new nodes are reachable only through the consumers with replaced inputs
+        std::vector<std::pair<std::shared_ptr<ov::Node>, ov::NodeVector>> groups;
+        for (const auto& consumer : consumers) {
+            auto new_nodes = collect_new_nodes(consumer.get());
+            if (!new_nodes.empty()) {
+                groups.emplace_back(consumer, std::move(new_nodes));
+            }
+        }
+
+        // the candidates are visited from the end of the order, so the consumers are decided before the producers
+        std::vector<std::pair<uint64_t, const ov::Node*>> removed;
+        uint64_t last_key = std::numeric_limits<uint64_t>::max();
+        while (!candidates.empty()) {
+            const auto candidate = candidates.top();
+            candidates.pop();
+            if (candidate.first > last_key) {
+                // an edge goes against the order, the decisions made for the later nodes can be wrong
+                return false;
+            }
+            last_key = candidate.first;
+            ov::Node* node = candidate.second.get();
+            if (m_removed.count(node) || is_reachable(node)) {
+                continue;
+            }
+            m_removed.insert(node);
+            removed.emplace_back(candidate.first, node);
+            for_each_dependency(node, [&](ov::Node* dependency) {
+                if (auto producer = find(dependency, key)) {
+                    candidates.emplace(key, producer);
+                }
+            });
+        }
+        for (const auto& group : groups) {
+            if (m_removed.count(group.first.get())) {
+                // the new nodes were assumed to be reachable through this consumer
+                return false;
+            }
+        }
+        for (const auto& node : removed) {
+            m_order.erase(node.first);
+            m_keys.erase(node.second);
+        }
+
+        for (const auto& group : groups) {
+            insert_before(group.first.get(), group.second);
+        }
+
+        // only the edges which end in the new nodes or in the consumers with replaced inputs can go against the order
+        std::vector<ov::Node*> dependencies;
+        for (const auto& node : consumers) {
+            if (!m_removed.count(node.get()) && !restore_order(node.get(), dependencies)) {
+                return false;
+            }
+        }
+        for (const auto& node : m_added_nodes) {
+            if (!restore_order(node.get(), dependencies)) {
+                return false;
+            }
+        }
+
+        // drop the keys of the destroyed nodes
+        if (m_keys.size() > 2 * m_order.size()) {
+            renumber();
+        }
+        return true;
+    }
+
+    /// \brief Returns the nodes which were added to the order
+    const ov::NodeVector& get_added_nodes() const {
+        return m_added_nodes;
+    }
+
+private:
+    std::shared_ptr<ov::Node> find(const ov::Node* node, uint64_t& key) const {
+        const auto key_it = m_keys.find(node);
+        if (key_it == m_keys.end()) {
+            return nullptr;
+        }
+        const auto it = m_order.find(key_it->second);
+        if (it == m_order.end()) {
+            return nullptr;
+        }
+        // the key can belong to a destroyed node with the same address
+        auto locked = it->second.lock();
+        if (locked.get() != node) {
+            return nullptr;
+        }
+        key = key_it->second;
+        return locked;
+    }
+
+    bool is_root(const ov::Node* node) {
+        if (m_roots.empty()) {
+            for (const auto& result : m_model.get_results()) {
+                m_roots.insert(result.get());
+            }
+            for (const auto& sink : m_model.get_sinks()) {
+                m_roots.insert(sink.get());
+            }
+            for (const auto& parameter : m_model.get_parameters()) {
+                m_roots.insert(parameter.get());
+            }
+        }
+        return m_roots.count(node) != 0;
+    }
+
+    bool is_reachable(ov::Node* node) {
+        if (is_root(node)) {
+            return true;
+        }
+        bool reachable = false;
+        uint64_t key = 0;
+        for_each_dependent(node, [&](ov::Node* dependent) {
+            reachable = reachable || m_added.count(dependent) || (!m_removed.count(dependent) && find(dependent, key));
+        });
+        return reachable;
+    }
+
+    // returns the nodes which are not in the order yet and are used by the consumer, producers go first
+    ov::NodeVector collect_new_nodes(ov::Node* consumer) {
+        ov::NodeVector new_nodes;
+        std::vector<ov::Node*> nodes_to_do;
+        uint64_t key = 0;
+        auto push_if_new = [&](ov::Node* node) {
+            if (!m_added.count(node) && !find(node, key)) {
+                nodes_to_do.push_back(node);
+                return true;
+            }
+            return false;
+        };
+        for_each_dependency(consumer, push_if_new);
+        while (!nodes_to_do.empty()) {
+            ov::Node* node = nodes_to_do.back();
+            if (m_added.count(node)) {
+                nodes_to_do.pop_back();
+                continue;
+            }
+            bool can_add = true;
+            for_each_dependency(node, [&](ov::Node* dependency) {
+                can_add = !push_if_new(dependency) && can_add;
+            });
+            if (can_add) {
+                nodes_to_do.pop_back();
+                m_added.insert(node);
+                new_nodes.push_back(node->shared_from_this());
+            }
+        }
+        return new_nodes;
+    }
+
+    void insert_before(ov::Node* consumer, const ov::NodeVector& nodes) {
+        uint64_t next_key = 0;
+        find(consumer, next_key);
+        auto next = m_order.find(next_key);
+        uint64_t prev_key = next == m_order.begin() ? 0 : std::prev(next)->first;
+        if ((next_key - prev_key) / (nodes.size() + 1) == 0) {
+            renumber();
+            find(consumer, next_key);
+            next = m_order.find(next_key);
+            prev_key = next == m_order.begin() ? 0 : std::prev(next)->first;
+        }
+        const uint64_t step = (next_key - prev_key) / (nodes.size() + 1);
+        uint64_t key = prev_key;
+        for (const auto& node : nodes) {
+            key += step;
+            m_order.emplace_hint(next, key, node);
+            m_keys[node.get()] = key;
+            m_added_nodes.push_back(node);
+        }
+    }
+
+    void renumber() {
+        OrderedOps order;
+        m_keys.clear();
+        uint64_t key = 0;
+        for (const auto& item : m_order) {
+            if (const auto node = item.second.lock()) {
+                key += order_key_stride;
+                order.emplace_hint(order.end(), key, item.second);
+                m_keys[node.get()] = key;
+            }
+        }
+        m_order.swap(order);
+    }
+
+    bool restore_order(ov::Node* node, std::vector<ov::Node*>& dependencies) {
+        dependencies.clear();
+        for_each_dependency(node, [&](ov::Node* dependency) {
+            dependencies.push_back(dependency);
+        });
+        uint64_t node_key = 0, dependency_key = 0;
+        for (const auto dependency : dependencies) {
+            if (!find(node, node_key) || !find(dependency, dependency_key)) {
+                return false;
+            }
+            if (dependency_key > node_key && !reorder(dependency, dependency_key, node, node_key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // restores the order after the edge from producer to consumer which goes against it:
+    // the nodes between them which depend on the consumer are moved after the nodes the producer depends on
+    bool reorder(ov::Node* producer, uint64_t upper_key, ov::Node* consumer, uint64_t lower_key) {
+        using KeyedNodes = std::vector<std::pair<uint64_t, std::shared_ptr<ov::Node>>>;
+        auto collect = [&](ov::Node* start, uint64_t start_key, const ov::Node* stop, bool forward, KeyedNodes& nodes) {
+            std::unordered_set<const ov::Node*> visited{start};
+            std::vector<ov::Node*> nodes_to_do{start};
+            nodes.emplace_back(start_key, start->shared_from_this());
+            bool cycle = false;
+            uint64_t key = 0;
+            auto visit = [&](ov::Node* node) {
+                if (node == stop) {
+                    cycle = true;
+                    return;
+                }
+                if (visited.count(node)) {
+                    return;
+                }
+                auto locked = find(node, key);
+                if (!locked || key <= lower_key || key >= upper_key) {
+                    return;
+                }
+                visited.insert(node);
+                nodes.emplace_back(key, locked);
+                nodes_to_do.push_back(node);
+            };
+            while (!nodes_to_do.empty() && !cycle) {
+                ov::Node* node = nodes_to_do.back();
+                nodes_to_do.pop_back();
+                if (forward) {
+                    for_each_dependent(node, visit);
+                } else {
+                    for_each_dependency(node, visit);
+                }
+            }
+            return !cycle;
+        };
+        KeyedNodes backward, forward;
+        if (!collect(consumer, lower_key, producer, true, forward) ||
+            !collect(producer, upper_key, consumer, false, backward)) {
+            return false;
+        }
+        std::sort(forward.begin(), forward.end());
+        std::sort(backward.begin(), backward.end());
+
+        std::vector<uint64_t> keys;
+        keys.reserve(forward.size() + backward.size());
+        for (const auto& item : backward) {
+            keys.push_back(item.first);
+            m_order.erase(item.first);
+        }
+        for (const auto& item : forward) {
+            keys.push_back(item.first);
+            m_order.erase(item.first);
+        }
+        std::sort(keys.begin(), keys.end());
+        auto key_it = keys.begin();
+        for (const auto* nodes : {&backward, &forward}) {
+            for (const auto& item : *nodes) {
+                m_order.emplace(*key_it, item.second);
+                m_keys[item.second.get()] = *key_it;
+                ++key_it;
+            }
+        }
+        return true;
+    }
+
+    const ov::Model& m_model;
+    OrderedOps& m_order;
+    OrderKeys& m_keys;
+    std::unordered_set<const ov::Node*> m_roots;
+    std::unordered_set<const ov::Node*> m_added;
+    std::unordered_set<const ov::Node*> m_removed;
+    ov::NodeVector m_added_nodes;
+};
+
 ngraph::ParameterVector auto_detect_parameters(const std::vector<std::shared_ptr<ov::Node>>& ordered_ops) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::auto_detect_parameters");
     ngraph::ParameterVector parameter_vector;
@@ -270,13 +613,31 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     lock_guard<mutex> lock(m_topological_sort_mutex);
 
     NodeVector nodes;
-    if (m_shared_rt_info->get_use_topological_cache()) {
-        for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
-                nodes.emplace_back(locked_node);
+    SharedRTInfo::ReplacedInputs replaced_inputs;
+    if (m_shared_rt_info->take_replaced_inputs(replaced_inputs)) {
+        bool updated = true;
+        if (!replaced_inputs.empty()) {
+            OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops::update");
+            TopologicalOrderUpdater updater(*this, m_cached_ordered_ops, m_cached_op_keys);
+            updated = m_use_default_topological_sorter && updater.update(replaced_inputs);
+            if (updated) {
+                for (const auto& node : updater.get_added_nodes()) {
+                    node->insert_info(m_shared_rt_info);
+                }
+            }
+        }
+        if (updated) {
+            nodes.reserve(m_cached_ordered_ops.size());
+            for (auto it = m_cached_ordered_ops.begin(); it != m_cached_ordered_ops.end();) {
+                if (auto locked_node = it->second.lock()) {
+                    nodes.emplace_back(std::move(locked_node));
+                    ++it;
+                } else {
+                    it = m_cached_ordered_ops.erase(it);
+                }
             }
+            return nodes;
         }
-        return nodes;
     }
 
     for (const auto& r : get_results()) {
@@ -294,10 +655,15 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
-    for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
-        m_cached_ordered_ops.push_back(node);
+    m_cached_op_keys.clear();
+    m_cached_op_keys.reserve(order.size());
+    uint64_t key = 0;
+    for (const auto& node : order) {
+        key += order_key_stride;
+        m_cached_ordered_ops.emplace_hint(m_cached_ordered_ops.end(), key, node);
+        m_cached_op_keys[node.get()] = key;
         node->insert_info(m_shared_rt_info);
-    });
+    }
     m_shared_rt_info->set_use_topological_cache(true);
 
     return order;
@@ -426,10 +792,13 @@ void ov::Model::replace_parameter(size_t parameter_index, const shared_ptr<ngrap
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    // reset topological nodes order cache as the parameter may have no consumers
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 void ov::Model::set_topological_sort(topological_sort_t sorter) {
     m_topological_sorter = sorter;
+    m_use_default_topological_sorter = false;
     // reset topological nodes order cache as new sorter can have different behaviour
     m_shared_rt_info->set_use_topological_cache(false);
 }
@@ -76,10 +76,18 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
+        // the producers of this node may become unreachable, so they are rechecked
+        // by the next update of the cached topological order
+        for (const auto& info : m_shared_rt_info) {
+            for (descriptor::Input& input : m_inputs) {
+                if (input.has_output()) {
+                    info->record_replaced_input(nullptr, input.get_output().get_node().get());
+                }
+            }
+            for (const auto& dependency : m_control_dependencies) {
+                info->record_replaced_input(nullptr, dependency.get());
+            }
+        }
 
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
@@ -141,6 +149,10 @@ void ov::Node::safe_delete(NodeVector& nodes, bool recurse) {
             // This test adds 1 to the actual count, so a count of 2 means this input is the only
             // reference to the node.
             auto node = input.get_output().get_node();
+            // the inputs are disconnected before the destructor, so the producers are recorded here
+            for (const auto& info : m_shared_rt_info) {
+                info->record_replaced_input(nullptr, node.get());
+            }
             if (node.use_count() == 2) {
                 // Move the node from the input to nodes so we don't trigger a deep recursive delete
                 nodes.push_back(node);
@@ -333,6 +345,10 @@ void ov::Node::transfer_control_dependents(std::shared_ptr<Node> replacement) {
 }
 
 void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
+    // the node may become unreachable, so the topological order has to be rebuilt
+    for_each(node->m_shared_rt_info.cbegin(), node->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
+        info->set_use_topological_cache(false);
+    });
     {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end()) {
@@ -349,6 +365,10 @@ void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
 
 void ov::Node::clear_control_dependencies() {
     for (auto& node : m_control_dependencies) {
+        // the node may become unreachable, so the topological order has to be rebuilt
+        for (const auto& info : node->m_shared_rt_info) {
+            info->set_use_topological_cache(false);
+        }
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
         if (it != node->m_control_dependents.end()) {
             node->m_control_dependents.erase(it);
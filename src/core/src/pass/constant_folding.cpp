@@ -4,20 +4,207 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph/opsets/opset3.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/validation_util.hpp"
+#include "openvino/op/sink.hpp"
+#include "openvino/op/util/read_value_base.hpp"
 
 using namespace std;
 
+namespace {
+// the minimal amount of the input data per folding thread, the smaller levels are folded sequentially
+constexpr size_t fold_data_per_thread = 1 << 20;
+
+bool can_be_folded_concurrently(const std::shared_ptr<ov::Node>& node) {
+    return node->get_input_size() != 0 && node->get_control_dependencies().empty() &&
+           !ov::is_type<ov::op::util::MultiSubGraphOp>(node) && !ov::is_type<ov::op::Sink>(node) &&
+           !ov::is_type<ov::op::util::ReadValueBase>(node) &&
+           node->get_rt_info().count(ov::pass::DisableConstantFolding::get_type_info_static()) == 0;
+}
+
+// Groups the nodes computable from the constants only by their depth: the nodes of one level depend on the constants
+// and on the nodes of the previous levels only, so they can be evaluated independently of each other.
+std::vector<ov::NodeVector> get_constant_levels(const std::vector<std::shared_ptr<ov::Node>>& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> depths;
+    std::vector<ov::NodeVector> levels;
+    for (const auto& node : ordered_ops) {
+        if (ov::is_type<ngraph::op::Constant>(node)) {
+            depths[node.get()] = 0;
+            continue;
+        }
+        if (!can_be_folded_concurrently(node))
+            continue;
+
+        size_t depth = 0;
+        bool from_constants = true;
+        for (const auto& input : node->input_values()) {
+            const auto it = depths.find(input.get_node());
+            if (it == depths.end()) {
+                from_constants = false;
+                break;
+            }
+            depth = std::max(depth, it->second);
+        }
+        if (!from_constants)
+            continue;
+
+        depths[node.get()] = depth + 1;
+        if (levels.size() <= depth)
+            levels.resize(depth + 1);
+        levels[depth].push_back(node);
+    }
+    return levels;
+}
+
+size_t get_input_byte_size(const std::shared_ptr<ov::Node>& node) {
+    size_t size = 0;
+    for (const auto& input : node->input_values()) {
+        if (input.get_partial_shape().is_static())
+            size += ov::shape_size(input.get_shape()) * input.get_element_type().size();
+    }
+    return size;
+}
+
+// Evaluates the nodes of one level, concurrently if the level is big enough. The graph is not modified here.
+// constant_fold may create temporary nodes on the inputs (e.g. ConvertLike folds through a temporary Convert), which
+// changes the consumers of the input outputs without synchronization. So only the nodes which don't share the input
+// producers with the other nodes of the level are evaluated concurrently, the rest are evaluated afterwards.
+void fold_level(const ov::NodeVector& level, std::vector<ov::OutputVector>& replacements, std::vector<char>& folded) {
+    auto fold = [&](size_t i) {
+        const auto& node = level[i];
+        replacements[i].resize(node->get_output_size());
+        folded[i] = node->constant_fold(replacements[i], node->input_values());
+    };
+
+    size_t data_size = 0;
+    std::unordered_map<const ov::Node*, size_t> producer_uses;
+    for (const auto& node : level) {
+        data_size += get_input_byte_size(node);
+        std::unordered_set<const ov::Node*> producers;
+        for (const auto& input : node->input_values()) {
+            producers.insert(input.get_node());
+        }
+        for (const auto& producer : producers) {
+            producer_uses[producer]++;
+        }
+    }
+
+    std::vector<size_t> concurrent, sequential;
+    for (size_t i = 0; i < level.size(); i++) {
+        const auto& inputs = level[i]->input_values();
+        const bool has_shared_inputs =
+            std::any_of(inputs.begin(), inputs.end(), [&](const ov::Output<ov::Node>& input) {
+                return producer_uses[input.get_node()] > 1;
+            });
+        (has_shared_inputs ? sequential : concurrent).push_back(i);
+    }
+
+    const size_t max_threads = std::min(concurrent.size(), data_size / fold_data_per_thread);
+    if (max_threads < 2) {
+        for (size_t i = 0; i < level.size(); i++) {
+            fold(i);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(level.size());
+    auto try_fold = [&](size_t i) {
+        try {
+            fold(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    // the threads are taken from the budget shared with the reference kernels, the nodes are picked dynamically
+    std::atomic<size_t> next{0};
+    ngraph::runtime::reference::parallel_for_chunks(
+        max_threads,
+        1,
+        [&](size_t, size_t) {
+            for (size_t k = next++; k < concurrent.size(); k = next++) {
+                try_fold(concurrent[k]);
+            }
+        },
+        max_threads);
+    for (const auto i : sequential) {
+        try_fold(i);
+    }
+
+    // the same error as the sequential folding would report
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops()) {
+    auto replace_outputs = [&](const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+        NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                     "constant_fold_default returned incorrect number of replacements for ",
+                     node);
+
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            auto node_output = node->output(i);
+            auto replacement = replacements.at(i);
+            if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                if (replacements.size() == 1) {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+                } else {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                         std::to_string(i));
+                }
+                node_output.replace(replacement);
+                // Propagate runtime info attributes to replacement consumer nodes
+                copy_runtime_info_to_target_inputs(node, replacement);
+
+                rewritten = true;
+            }
+        }
+    };
+
+    const auto ordered_ops = f->get_ordered_ops();
+
+    // The subgraphs computable from the constants only are folded first level by level. The nodes of one level are
+    // evaluated concurrently, their replacements are collected and applied after the whole level is evaluated. The
+    // order of the nodes within a level is arbitrary, they don't depend on each other, so it doesn't affect the result.
+    std::unordered_set<const Node*> folded_by_levels;
+    for (const auto& level : get_constant_levels(ordered_ops)) {
+        if (rewritten) {
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
+        }
+
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), 0);
+        fold_level(level, replacements, folded);
+
+        for (size_t i = 0; i < level.size(); i++) {
+            folded_by_levels.insert(level[i].get());
+            if (folded[i])
+                replace_outputs(level[i], replacements[i]);
+        }
+    }
+
+    for (const auto& node : ordered_ops) {
+        if (folded_by_levels.count(node.get()))
+            continue;
+
         if (rewritten) {
             node->validate_and_infer_types();
         }
@@ -28,27 +215,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f
         // method, so we can't always rely on attribute check inside default node->constant_fold method
         if (node->get_rt_info().count(DisableConstantFolding::get_type_info_static()) == 0 &&
             node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            replace_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
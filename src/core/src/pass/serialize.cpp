@@ -7,6 +7,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <ngraph/variant.hpp>
 #include <unordered_map>
@@ -16,6 +17,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/opsets/opset1.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "pugixml.hpp"
@@ -88,7 +90,9 @@ public:
           m_enable_compression(enable_compression),
           m_blob_offset(bin_data.tellp()) {}
 
-    FilePosition write(const char* ptr, size_t size) {
+    virtual ~ConstantWriter() = default;
+
+    virtual FilePosition write(const char* ptr, size_t size) {
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
@@ -979,7 +983,7 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
 }
 
 void serializeFunc(std::ostream& xml_file,
-                   std::ostream& bin_file,
+                   ConstantWriter& constant_write_handler,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
@@ -1004,15 +1008,24 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
     xml_doc.save(xml_file);
     xml_file.flush();
-    bin_file.flush();
 };
 
+void serializeFunc(std::ostream& xml_file,
+                   std::ostream& bin_file,
+                   std::shared_ptr<ov::Model> f,
+                   ov::pass::Serialize::Version ver,
+                   const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                   bool deterministic = false) {
+    ConstantWriter constant_write_handler(bin_file);
+    serializeFunc(xml_file, constant_write_handler, f, ver, custom_opsets, deterministic);
+    bin_file.flush();
+}
+
 }  // namespace
 
 namespace ov {
@@ -1172,44 +1185,139 @@ static uint64_t hash_combine(uint64_t seed, const T& a) {
     return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
 }
 
-class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+// 64-bit hash of xxHash64 design: the main loop updates four independent lanes, so it is pipelined
+// (and vectorized where 64-bit multiplication is available) by the compiler
+constexpr uint64_t prime1 = 11400714785074694791ULL;
+constexpr uint64_t prime2 = 14029467366897019727ULL;
+constexpr uint64_t prime3 = 1609587929392839161ULL;
+constexpr uint64_t prime4 = 9650029242287828579ULL;
+constexpr uint64_t prime5 = 2870177450012600261ULL;
 
-public:
-    uint64_t getResult() const {
-        return m_res;
-    }
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t round64(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t merge_round64(uint64_t acc, uint64_t val) {
+    acc ^= round64(0, val);
+    return acc * prime1 + prime4;
+}
+
+uint64_t hash_data(const char* data, size_t size, uint64_t seed = 0) {
+    const char* p = data;
+    const char* const end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        uint64_t v[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+        const char* const limit = end - 32;
+        do {
+            for (size_t lane = 0; lane < 4; lane++) {
+                v[lane] = round64(v[lane], read64(p + lane * 8));
+            }
+            p += 32;
+        } while (p <= limit);
 
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        h = rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18);
+        for (size_t lane = 0; lane < 4; lane++) {
+            h = merge_round64(h, v[lane]);
         }
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= round64(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        h ^= static_cast<uint64_t>(v) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= static_cast<uint64_t>(static_cast<uint8_t>(*p)) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+constexpr size_t hash_chunk_size = 1 << 22;
+// the minimal amount of the constants data per hashing thread
+constexpr size_t hash_data_per_thread = 4 * hash_chunk_size;
+
+// Collects the constants instead of writing them: the data is hashed afterwards by fixed size chunks, so the
+// result doesn't depend on the number of threads used
+class ConstantHashWriter final : public ConstantWriter {
+public:
+    explicit ConstantHashWriter(std::ostream& bin_data) : ConstantWriter(bin_data, false) {}
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+    FilePosition write(const char* ptr, size_t size) override {
+        const auto offset = m_offset;
+        for (size_t pos = 0; pos < size; pos += hash_chunk_size) {
+            m_chunks.emplace_back(ptr + pos, std::min(hash_chunk_size, size - pos));
         }
-        return n;
+        m_offset += static_cast<FilePosition>(size);
+        return offset;
     }
+
+    uint64_t get_result() const {
+        std::vector<uint64_t> digests(m_chunks.size());
+        // the helper threads are taken from the budget shared with the reference kernels
+        const size_t max_threads = std::max<size_t>(1, static_cast<size_t>(m_offset) / hash_data_per_thread);
+        ngraph::runtime::reference::parallel_for_chunks(
+            m_chunks.size(),
+            1,
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    digests[i] = hash_data(m_chunks[i].first, m_chunks[i].second);
+                }
+            },
+            max_threads);
+
+        return hash_data(reinterpret_cast<const char*>(digests.data()), digests.size() * sizeof(uint64_t));
+    }
+
+private:
+    std::vector<std::pair<const char*, size_t>> m_chunks;
+    FilePosition m_offset = 0;
 };
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
+    // The weights are not serialized: only the structure goes to the XML, the constants data is hashed in place
+    std::stringstream xml;
+    std::stringstream bin;
+    ConstantHashWriter constant_hash_writer(bin);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, constant_hash_writer, f, Serialize::Version::UNSPECIFIED, {}, true);
 
+    const auto xml_str = xml.str();
     uint64_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    seed = hash_combine(seed, hash_data(xml_str.data(), xml_str.size()));
+    seed = hash_combine(seed, constant_hash_writer.get_result());
 
     m_hash = seed;
     // Return false because we didn't change nGraph Function
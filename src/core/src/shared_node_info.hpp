@@ -5,23 +5,63 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <utility>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
 public:
+    using ReplacedInputs = std::vector<std::pair<Node*, Node*>>;
+
     SharedRTInfo() : m_use_topological_cache(false) {}
 
+    /// \brief Marks the cached topological order as valid or requests to rebuild it from scratch
     void set_use_topological_cache(bool status) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_use_topological_cache = status;
+        m_replaced_inputs.clear();
     }
 
+    /// \brief Returns true if the cached topological order matches the model
     bool get_use_topological_cache() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_use_topological_cache && m_replaced_inputs.empty();
+    }
+
+    /// \brief Records that the input of the consumer node was switched from the old producer.
+    /// The cached topological order stays valid for the rest of the model, so it is updated
+    /// by the next Model::get_ordered_ops call instead of being rebuilt.
+    void record_replaced_input(Node* consumer, Node* old_producer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_use_topological_cache) {
+            return;
+        }
+        // it's cheaper to sort the model again than to replay a large number of changes
+        if (m_replaced_inputs.size() >= max_replaced_inputs) {
+            m_use_topological_cache = false;
+            m_replaced_inputs.clear();
+            return;
+        }
+        m_replaced_inputs.emplace_back(consumer, old_producer);
+    }
+
+    /// \brief Moves the recorded input replacements to the given vector.
+    /// \return false if the cached topological order must be rebuilt from scratch
+    bool take_replaced_inputs(ReplacedInputs& replaced_inputs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        replaced_inputs.clear();
+        std::swap(replaced_inputs, m_replaced_inputs);
         return m_use_topological_cache;
     }
 
 private:
+    static constexpr size_t max_replaced_inputs = 1 << 16;
+
     bool m_use_topological_cache;
+    ReplacedInputs m_replaced_inputs;
+    mutable std::mutex m_mutex;
 };
 }  // namespace ov
@@ -451,6 +451,75 @@ static void test_const_convert(const vector<T>& values_in, const vector<U>& valu
     ASSERT_EQ(values_expected, values_out);
 }
 
+TEST(constant_folding, independent_constant_subgraphs) {
+    // several dequantization-like chains big enough to be folded concurrently
+    const size_t chains_num = 8;
+    const Shape shape{1024, 1024};
+    const auto size = shape_size(shape);
+
+    ResultVector results;
+    for (size_t i = 0; i < chains_num; i++) {
+        auto data = make_shared<op::Constant>(element::u8, shape, vector<uint8_t>(size, static_cast<uint8_t>(i)));
+        auto convert = make_shared<op::v0::Convert>(data, element::f32);
+        auto shift = op::Constant::create(element::f32, Shape{1}, {1.0f});
+        auto sub = make_shared<op::v1::Subtract>(convert, shift);
+        auto scale = op::Constant::create(element::f32, Shape{1}, {0.5f});
+        auto mul = make_shared<op::v1::Multiply>(sub, scale);
+        mul->set_friendly_name("mul_" + std::to_string(i));
+        results.push_back(make_shared<op::Result>(mul));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), chains_num);
+
+    for (size_t i = 0; i < chains_num; i++) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results()[i]->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(), "mul_" + std::to_string(i));
+        const auto values_out = new_const->get_vector<float>();
+        const vector<float> values_expected(size, (static_cast<float>(i) - 1.0f) * 0.5f);
+        ASSERT_EQ(values_expected, values_out);
+    }
+}
+
+TEST(constant_folding, constant_subgraphs_with_shared_inputs) {
+    // ConvertLike folds through a temporary Convert created on the input, so the nodes sharing the input constant
+    // must not be folded concurrently
+    const size_t nodes_num = 8;
+    const Shape shape{1024, 1024};
+    const auto size = shape_size(shape);
+    auto data = make_shared<op::Constant>(element::u8, shape, vector<uint8_t>(size, 3));
+
+    ResultVector results;
+    for (size_t i = 0; i < nodes_num; i++) {
+        auto like = op::Constant::create(element::f32, Shape{}, {0.0f});
+        auto convert_like = make_shared<op::v1::ConvertLike>(data, like);
+        convert_like->set_friendly_name("convert_like_" + std::to_string(i));
+        results.push_back(make_shared<op::Result>(convert_like));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::ConvertLike>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    for (size_t i = 0; i < nodes_num; i++) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results()[i]->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(), "convert_like_" + std::to_string(i));
+        ASSERT_EQ(new_const->get_vector<float>(), vector<float>(size, 3.0f));
+    }
+}
+
 TEST(constant_folding, const_convert) {
     {
         vector<float> in{1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7};
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "gtest/gtest.h"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov;
+using namespace ov::frontend;
+
+namespace {
+#ifdef __linux__
+// checks whether the address belongs to a mapping of the file with the given name in this process
+bool is_in_file_mapping(const void* address, const std::string& file_name) {
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    const auto ptr = reinterpret_cast<uintptr_t>(address);
+    while (std::getline(maps, line)) {
+        if (line.size() < file_name.size() || line.compare(line.size() - file_name.size(), file_name.size(), file_name))
+            continue;
+        unsigned long long begin = 0, end = 0;
+        if (std::sscanf(line.c_str(), "%llx-%llx", &begin, &end) == 2 && begin <= ptr && ptr < end)
+            return true;
+    }
+    return false;
+}
+#endif
+}  // namespace
+
+// the content of Const tensors is read from the memory mapped model file instead of the parsed GraphDef
+TEST(FrontEndConvertModelTest, const_tensor_content) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+    ASSERT_NE(frontEnd, nullptr);
+    auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                             std::string("const_tensor_content/const_tensor_content.pb"));
+    ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+    ASSERT_NE(inputModel, nullptr);
+    std::shared_ptr<Model> model;
+    ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+    ASSERT_NE(model, nullptr);
+    // the mapping must stay valid when the frontend objects are released
+    inputModel.reset();
+
+    std::shared_ptr<opset8::Constant> constant;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (op->get_friendly_name() == "const1") {
+            constant = std::dynamic_pointer_cast<opset8::Constant>(op);
+        }
+    }
+    ASSERT_NE(constant, nullptr);
+    EXPECT_EQ(constant->get_shape(), (Shape{2, 3, 4}));
+    std::vector<float> expected(24);
+    std::iota(expected.begin(), expected.end(), 0.f);
+    EXPECT_EQ(constant->cast_vector<float>(), expected);
+
+#ifdef __linux__
+    // the content is shared with the mapped model file when it is aligned there, and copied otherwise
+    std::ifstream model_file(model_filename, std::ios::binary);
+    const std::string model_bytes((std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>());
+    const auto offset = model_bytes.find(std::string(reinterpret_cast<const char*>(expected.data()),
+                                                     expected.size() * sizeof(float)));
+    ASSERT_NE(offset, std::string::npos);
+    EXPECT_EQ(is_in_file_mapping(constant->get_data_ptr(), "const_tensor_content.pb"), offset % sizeof(float) == 0);
+#endif
+}
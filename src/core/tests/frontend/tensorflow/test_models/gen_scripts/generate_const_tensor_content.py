@@ -0,0 +1,23 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model
+with tf.compat.v1.Session() as sess:
+    input1 = tf.compat.v1.placeholder(tf.float32, [2, 3, 4], 'inputX1')
+
+    # a multi-element constant is serialized to tensor_content
+    const1 = tf.constant(np.arange(24, dtype=np.float32).reshape([2, 3, 4]), name="const1")
+
+    tf.add(input1, const1, name="add1")
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "const_tensor_content"), 'const_tensor_content.pb', False)
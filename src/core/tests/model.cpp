@@ -6,9 +6,12 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
 #include <shared_node_info.hpp>
 #include <test_common.hpp>
+#include <unordered_map>
 
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/opsets/opset8.hpp"
 
@@ -1377,6 +1380,165 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+namespace {
+// checks the cached order against the order built from scratch
+void check_ordered_ops(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+    ASSERT_TRUE(ov::ModelAccessor(f).get_shared_info()->get_use_topological_cache());
+
+    ov::NodeVector roots;
+    for (const auto& result : f->get_results()) {
+        roots.push_back(result);
+    }
+    for (const auto& sink : f->get_sinks()) {
+        roots.push_back(sink);
+    }
+    for (const auto& param : f->get_parameters()) {
+        roots.push_back(param);
+    }
+    const auto expected = ov::topological_sort(roots);
+    ASSERT_EQ(ordered_ops.size(), expected.size());
+
+    std::unordered_map<ov::Node*, size_t> positions;
+    for (size_t i = 0; i < ordered_ops.size(); i++) {
+        positions[ordered_ops[i].get()] = i;
+    }
+    for (const auto& node : expected) {
+        ASSERT_TRUE(positions.count(node.get())) << node;
+        for (const auto& input : node->input_values()) {
+            ASSERT_LT(positions.at(input.get_node()), positions.at(node.get())) << node;
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            ASSERT_LT(positions.at(dependency.get()), positions.at(node.get())) << node;
+        }
+    }
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+}  // namespace
+
+TEST(model, topological_sort_caching_incremental_replace_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto relu3 = std::make_shared<ov::opset8::Relu>(relu2);
+    auto result = std::make_shared<ov::opset8::Result>(relu3);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    // the replaced node is kept alive, but it's not in the model anymore
+    auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(relu1);
+    auto abs = std::make_shared<ov::opset8::Abs>(sigmoid);
+    ov::replace_node(relu2, abs);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 6);
+
+    // the replacement skips several nodes
+    ov::replace_node(abs, arg0);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(model, topological_sort_caching_incremental_destroyed_consumer) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(std::make_shared<ov::opset8::Relu>(relu1));
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    // relu1 is alive, but its only consumer is destroyed
+    result->input(0).replace_source_output(arg0);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 2);
+}
+
+TEST(model, topological_sort_caching_incremental_reorder) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto a1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto a2 = std::make_shared<ov::opset8::Relu>(a1);
+    auto a3 = std::make_shared<ov::opset8::Relu>(a2);
+    auto b1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto b2 = std::make_shared<ov::opset8::Relu>(b1);
+    auto b3 = std::make_shared<ov::opset8::Relu>(b2);
+    auto result_a = std::make_shared<ov::opset8::Result>(a3);
+    auto result_b = std::make_shared<ov::opset8::Result>(b3);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result_a, result_b}, ov::ParameterVector{arg0});
+
+    // the branches are ordered one after another, so the new edges go against the order
+    a1->input(0).replace_source_output(b3);
+    check_ordered_ops(f);
+    b1->input(0).replace_source_output(std::make_shared<ov::opset8::Abs>(a2));
+    ASSERT_FALSE(ov::ModelAccessor(f).get_shared_info()->get_use_topological_cache());
+    // b1 -> ... -> a1 -> a2 -> Abs -> b1 is a cycle, so a1 is reconnected first
+    a1->input(0).replace_source_output(arg0);
+    check_ordered_ops(f);
+}
+
+TEST(model, topological_sort_caching_incremental_random_changes) {
+    std::mt19937 gen(0);
+    const ov::Shape shape{1};
+    // the nodes only use the nodes with the smaller index, so the graph has no cycles
+    std::vector<std::pair<double, std::shared_ptr<ov::Node>>> nodes;
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+    nodes.emplace_back(0.0, param);
+    auto pick_before = [&](double index) {
+        std::vector<std::shared_ptr<ov::Node>> candidates;
+        for (const auto& node : nodes) {
+            if (node.first < index && !ov::is_type<ov::opset8::Result>(node.second)) {
+                candidates.push_back(node.second);
+            }
+        }
+        return candidates[std::uniform_int_distribution<size_t>(0, candidates.size() - 1)(gen)];
+    };
+    auto make_node = [&](double index) -> std::shared_ptr<ov::Node> {
+        if (gen() % 2) {
+            return std::make_shared<ov::opset8::Relu>(pick_before(index));
+        }
+        return std::make_shared<ov::opset8::Add>(pick_before(index), pick_before(index));
+    };
+    for (int i = 1; i < 200; i++) {
+        nodes.emplace_back(i, make_node(i));
+    }
+    ov::ResultVector results;
+    for (int i = 0; i < 5; i++) {
+        results.push_back(std::make_shared<ov::opset8::Result>(pick_before(1000)));
+        nodes.emplace_back(1000 + i, results.back());
+    }
+    auto f = std::make_shared<ov::Model>(results, ov::ParameterVector{param});
+    check_ordered_ops(f);
+
+    for (int iteration = 0; iteration < 300; iteration++) {
+        const size_t num_changes = 1 + gen() % 4;
+        for (size_t change = 0; change < num_changes; change++) {
+            const size_t position = 1 + gen() % (nodes.size() - 1);
+            const double index = nodes[position].first;
+            const auto node = nodes[position].second;
+            switch (gen() % 3) {
+            case 0: {
+                // replace the node, the new node gets the index between its inputs and its consumers
+                if (ov::is_type<ov::opset8::Result>(node)) {
+                    break;
+                }
+                auto new_node = make_node(index);
+                ov::replace_node(node, new_node);
+                nodes.emplace_back(index, new_node);
+                break;
+            }
+            case 1: {
+                // reconnect one of the inputs
+                const size_t input = gen() % node->get_input_size();
+                node->input(input).replace_source_output(pick_before(index));
+                break;
+            }
+            default:
+                // drop the reference, so the node is destroyed when it's not used anymore
+                if (!ov::is_type<ov::opset8::Result>(node)) {
+                    nodes.erase(nodes.begin() + position);
+                }
+                break;
+            }
+        }
+        check_ordered_ops(f);
+    }
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
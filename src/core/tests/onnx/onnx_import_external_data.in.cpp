@@ -123,3 +123,54 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path) {
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_share_file_mapping) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            constants.emplace(constant->get_friendly_name(), constant);
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both tensors point into the single mapping of the file, "data_b" is stored at the 4096 offset
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    EXPECT_EQ(constants["data_b"]->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_misaligned_offset) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_misaligned_offset.onnx"));
+
+    std::shared_ptr<default_opset::Constant> constant;
+    for (const auto& op : function->get_ops()) {
+        if (const auto c = ov::as_type_ptr<default_opset::Constant>(op)) {
+            constant = c;
+        }
+    }
+    ASSERT_NE(constant, nullptr);
+    // the data stored at the odd offset of the file is copied into the aligned buffer of the constant
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % sizeof(int32_t), 0);
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<int32_t>({1, 2, 3});
+    test_case.add_expected_output<int32_t>(Shape{3}, {5, 7, 9});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_empty_file) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_empty_file.onnx"));
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<int32_t>({1, 2, 3});
+    test_case.add_expected_output<int32_t>(Shape{3}, {1, 2, 3});
+
+    test_case.run();
+}
@@ -12,6 +12,10 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +46,60 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+// replaces every n-th Relu of the model with a new one
+class ReplaceRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReplaceRelu");
+    explicit ReplaceRelu(size_t period) {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        auto counter = std::make_shared<size_t>(0);
+        ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+            if ((*counter)++ % period != 0) {
+                return false;
+            }
+            auto root = m.get_match_root();
+            ov::replace_node(root, std::make_shared<ov::opset8::Relu>(root->input_value(0)));
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "ReplaceRelu"), callback);
+    }
+};
+
+// a chain of residual blocks x = x + Relu(x * c) like in the transformer models
+std::shared_ptr<ov::Model> make_residual_model(size_t num_blocks) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    ov::Output<ov::Node> x = param;
+    for (size_t i = 0; i < num_blocks; i++) {
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 16}, std::vector<float>(16, 0.5f));
+        auto relu = std::make_shared<ov::opset8::Relu>(std::make_shared<ov::opset8::Multiply>(x, scale));
+        x = std::make_shared<ov::opset8::Add>(x, relu);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{x}, ov::ParameterVector{param});
+}
+}  // namespace
+
+// Runs the pass pipeline with the incrementally updated topological order and with the order rebuilt from scratch
+// after every change (a custom sorter disables the updates), both orders must be valid for the same graph.
+TEST(pass_manager, incremental_topological_sort_matches_full_sort) {
+    const size_t num_blocks = 500;
+    const size_t num_passes = 5;
+    auto run = [&](bool incremental) {
+        auto model = make_residual_model(num_blocks);
+        if (!incremental) {
+            model->set_topological_sort(ov::topological_sort<std::vector<std::shared_ptr<ov::Node>>>);
+        }
+        ov::pass::Manager manager;
+        for (size_t i = 0; i < num_passes; i++) {
+            manager.register_pass<ReplaceRelu>(100);
+        }
+        manager.run_passes(model);
+        return model->get_ordered_ops();
+    };
+    const auto full_ops = run(false);
+    const auto incremental_ops = run(true);
+    EXPECT_EQ(full_ops.size(), incremental_ops.size());
+    EXPECT_TRUE(validate_list(full_ops));
+    EXPECT_TRUE(validate_list(incremental_ops));
+}
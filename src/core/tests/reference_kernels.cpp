@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace ngraph;
+
+namespace {
+// the plain i-k-j loop, the blocked kernel must keep its accumulation order
+template <typename T>
+void naive_dot(const T* arg0, const T* arg1, T* out, size_t I_dim, size_t K_dim, size_t J_dim) {
+    std::fill(out, out + I_dim * J_dim, T{0});
+    for (size_t i = 0; i < I_dim; ++i) {
+        for (size_t k = 0; k < K_dim; ++k) {
+            for (size_t j = 0; j < J_dim; ++j) {
+                out[i * J_dim + j] += arg0[i * K_dim + k] * arg1[k * J_dim + j];
+            }
+        }
+    }
+}
+
+// the floating point values are multiples of 1/4, the integer ones span a wide range which still can't overflow
+// the K <= 1024 dot products
+template <typename T>
+std::vector<T> random_vector(size_t size, std::mt19937& gen) {
+    const bool is_integral = std::is_integral<T>::value;
+    std::uniform_int_distribution<int> dist(is_integral ? -1000 : -8, is_integral ? 1000 : 8);
+    std::vector<T> v(size);
+    for (auto& x : v) {
+        x = is_integral ? static_cast<T>(dist(gen)) : static_cast<T>(dist(gen)) / T{4};
+    }
+    return v;
+}
+
+template <typename T>
+void check_matmul(size_t I, size_t K, size_t J) {
+    std::mt19937 gen(I * K * J);
+    const auto a = random_vector<T>(I * K, gen);
+    const auto b = random_vector<T>(K * J, gen);
+    std::vector<T> expected(I * J), result(I * J);
+
+    naive_dot(a.data(), b.data(), expected.data(), I, K, J);
+    runtime::reference::matmul(a.data(), b.data(), result.data(), Shape{I, K}, Shape{K, J}, Shape{I, J}, false, false);
+
+    EXPECT_EQ(expected, result) << "I=" << I << " K=" << K << " J=" << J;
+}
+}  // namespace
+
+TEST(reference_kernels, parallel_for_chunks_covers_range) {
+    std::vector<std::atomic<int>> visits(100003);
+    runtime::reference::parallel_for_chunks(visits.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    for (const auto& v : visits) {
+        ASSERT_EQ(v.load(), 1);
+    }
+}
+
+TEST(reference_kernels, parallel_for_chunks_rethrows) {
+    EXPECT_THROW(runtime::reference::parallel_for_chunks(1000,
+                                                         1,
+                                                         [](size_t begin, size_t) {
+                                                             if (begin == 0) {
+                                                                 throw std::runtime_error("error");
+                                                             }
+                                                         }),
+                 std::runtime_error);
+}
+
+TEST(reference_kernels, parallel_for_chunks_honours_max_threads) {
+    std::atomic<size_t> chunks{0};
+    runtime::reference::parallel_for_chunks(
+        1000,
+        1,
+        [&](size_t, size_t) {
+            chunks++;
+        },
+        1);
+    EXPECT_EQ(chunks.load(), 1);
+
+    chunks = 0;
+    runtime::reference::parallel_for_chunks(
+        1000,
+        1,
+        [&](size_t, size_t) {
+            chunks++;
+        },
+        2);
+    EXPECT_LE(chunks.load(), 2);
+}
+
+TEST(reference_kernels, parallel_for_chunks_nested_calls_cover_range) {
+    std::vector<std::atomic<int>> visits(1000 * 1000);
+    runtime::reference::parallel_for_chunks(1000, 1, [&](size_t outer_begin, size_t outer_end) {
+        for (size_t i = outer_begin; i < outer_end; ++i) {
+            runtime::reference::parallel_for_chunks(1000, 1, [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j) {
+                    visits[i * 1000 + j]++;
+                }
+            });
+        }
+    });
+    for (const auto& v : visits) {
+        ASSERT_EQ(v.load(), 1);
+    }
+}
+
+TEST(reference_kernels, matmul_blocked_f32) {
+    check_matmul<float>(1, 7, 3);
+    check_matmul<float>(5, 1, 9);
+    check_matmul<float>(33, 130, 517);
+    check_matmul<float>(129, 300, 40);
+}
+
+TEST(reference_kernels, matmul_blocked_i32) {
+    check_matmul<int32_t>(17, 257, 513);
+}
+
+TEST(reference_kernels, matmul_batched_f32) {
+    const Shape a_shape{3, 4, 5, 6}, b_shape{3, 4, 6, 7}, out_shape{3, 4, 5, 7};
+    std::mt19937 gen(0);
+    const auto a = random_vector<float>(shape_size(a_shape), gen);
+    const auto b = random_vector<float>(shape_size(b_shape), gen);
+    std::vector<float> expected(shape_size(out_shape)), result(shape_size(out_shape));
+
+    for (size_t batch = 0; batch < 12; ++batch) {
+        naive_dot(a.data() + batch * 30, b.data() + batch * 42, expected.data() + batch * 35, 5, 6, 7);
+    }
+    runtime::reference::matmul(a.data(), b.data(), result.data(), a_shape, b_shape, out_shape, false, false);
+
+    EXPECT_EQ(expected, result);
+}
+
+TEST(reference_kernels, convolution_padded_strided_dilated) {
+    const Shape in_shape{2, 3, 9, 11}, f_shape{4, 3, 3, 3};
+    const Strides strides{2, 1}, dilations{2, 1};
+    const CoordinateDiff pads_begin{1, 2}, pads_end{2, 1};
+    const size_t out_h = (9 + 3 - (2 * 2 + 1)) / 2 + 1, out_w = (11 + 3 - 3) + 1;
+    const Shape out_shape{2, 4, out_h, out_w};
+
+    std::mt19937 gen(0);
+    const auto in = random_vector<float>(shape_size(in_shape), gen);
+    const auto f = random_vector<float>(shape_size(f_shape), gen);
+    std::vector<float> expected(shape_size(out_shape)), result(shape_size(out_shape));
+
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t oc = 0; oc < 4; ++oc) {
+            for (size_t y = 0; y < out_h; ++y) {
+                for (size_t x = 0; x < out_w; ++x) {
+                    float sum = 0;
+                    for (size_t ic = 0; ic < 3; ++ic) {
+                        for (int fy = 0; fy < 3; ++fy) {
+                            for (int fx = 0; fx < 3; ++fx) {
+                                const int iy = static_cast<int>(y * 2) - 1 + fy * 2;
+                                const int ix = static_cast<int>(x) - 2 + fx;
+                                if (iy < 0 || iy >= 9 || ix < 0 || ix >= 11) {
+                                    continue;
+                                }
+                                sum += in[((n * 3 + ic) * 9 + iy) * 11 + ix] * f[((oc * 3 + ic) * 3 + fy) * 3 + fx];
+                            }
+                        }
+                    }
+                    expected[((n * 4 + oc) * out_h + y) * out_w + x] = sum;
+                }
+            }
+        }
+    }
+    runtime::reference::convolution(in.data(),
+                                    f.data(),
+                                    result.data(),
+                                    in_shape,
+                                    f_shape,
+                                    out_shape,
+                                    strides,
+                                    dilations,
+                                    pads_begin,
+                                    pads_end);
+
+    EXPECT_EQ(expected, result);
+}
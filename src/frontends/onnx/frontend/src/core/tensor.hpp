@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -443,6 +445,9 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (detail::has_tensor_external_data(*m_tensor_proto)) {
+            return make_ng_constant_from_external_data(get_ng_type());
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -476,6 +481,29 @@ public:
     }
 
 private:
+    /// \brief      Creates a constant which shares the memory mapped external data of the tensor.
+    ///
+    /// \note       The data which is not aligned to the element size in the file is copied into the constant.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_external_data(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        const auto external_data = tensor_external_data.load_external_mmap_data();
+        if (external_data->size() < (shape_size(m_shape) * type.bitwidth() + 7) / 8) {
+            throw error::tensor::shape_doesnt_match_data_size{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (reinterpret_cast<uintptr_t>(external_data->get_ptr()) % type.size() == 0) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+        } else {
+            NGRAPH_DEBUG << "External data is not aligned to the element size, it is copied: "
+                         << tensor_external_data.to_string();
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data->get_ptr());
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -484,10 +512,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = detail::get_data_size(*m_tensor_proto);
-        if (detail::has_tensor_external_data(*m_tensor_proto)) {
-            auto external_data = detail::load_external_data(*m_tensor_proto);
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, detail::get_data_ptr(*m_tensor_proto));
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
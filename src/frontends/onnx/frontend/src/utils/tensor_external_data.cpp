@@ -4,67 +4,96 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+namespace {
+/// \brief      Returns the mapping of the external data file, the file is mapped only if it is not mapped yet.
+///
+/// \note       The registry keeps weak references only, so the mapping lives as long as the constants which use it.
+std::shared_ptr<ngraph::runtime::AlignedBuffer> get_mapped_file(const std::string& location) {
+    static std::mutex mapped_files_mutex;
+    static std::map<std::string, std::weak_ptr<ngraph::runtime::AlignedBuffer>> mapped_files;
+
+    std::lock_guard<std::mutex> lock(mapped_files_mutex);
+    for (auto it = mapped_files.begin(); it != mapped_files.end();) {
+        it = it->second.expired() ? mapped_files.erase(it) : std::next(it);
+    }
+    auto& mapped_file = mapped_files[location];
+    auto mapping = mapped_file.lock();
+    if (!mapping) {
+        NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        auto mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(location));
+#else
+        auto mapped_memory = ov::util::load_mmap_object(location);
+#endif
+        NGRAPH_SUPPRESS_DEPRECATED_END
+        mapping = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory);
+        mapped_file = mapping;
+    }
+    return mapping;
+}
+}  // namespace
+
 TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
 }
 
 std::string TensorExternalData::load_external_data() const {
-    NGRAPH_SUPPRESS_DEPRECATED_START
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring path = ov::util::string_to_wstring(m_data_location);
-#else
-    std::string path = m_data_location;
-#endif
-    NGRAPH_SUPPRESS_DEPRECATED_END
-    std::ifstream external_data_stream(path, std::ios::binary | std::ios::in | std::ios::ate);
-    if (external_data_stream.fail())
-        throw error::invalid_external_data{*this};
-
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
+    const auto buffer = load_external_mmap_data();
+    if (buffer->size() == 0) {
+        return {};
+    }
+    return std::string(buffer->get_ptr<char>(), buffer->size());
+}
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
+std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>
+TensorExternalData::load_external_mmap_data() const {
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> mapping;
+    try {
+        mapping = get_mapped_file(m_data_location);
+    } catch (const std::exception&) {
+        throw error::invalid_external_data{*this};
     }
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+
+    const uint64_t file_size = mapping->size();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
+    // default value of m_data_length is 0 which means the data up to the end of the file
+    const uint64_t data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
-
-    return read_data;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        mapping->get_ptr<char>() + m_offset,
+        static_cast<size_t>(data_length),
+        mapping);
 }
 
 std::string TensorExternalData::to_string() const {
@@ -6,6 +6,8 @@
 
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
@@ -23,6 +25,17 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       Every external file is mapped once, the tensors stored in the same file
+    ///             share the mapping which is released together with the last returned buffer.
+    /// \note       If mapping the external file fails or the data exceeds the file size,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer which points to the external data inside of the file mapping
+    std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>> load_external_mmap_data()
+        const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -30,8 +43,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
@@ -5,6 +5,7 @@
 #include "decoder_proto.hpp"
 
 #include "openvino/frontend/tensorflow/node_context.hpp"
+#include "utils.hpp"
 
 namespace ov {
 namespace frontend {
@@ -35,6 +36,12 @@ ov::Any DecoderProto::get_native_attribute(const std::string& name) const {
 
     switch (attrs[0].value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kTensor:
+        if (name == "value" && m_tensor_content) {
+            // the content is materialized from the model file only on request
+            auto tensor = attrs[0].tensor();
+            tensor.set_tensor_content(m_tensor_content->get_ptr<char>(), m_tensor_content->size());
+            return tensor;
+        }
         return attrs[0].tensor();
     case ::tensorflow::AttrValue::ValueCase::kType:
         return attrs[0].type();
@@ -167,8 +174,17 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
+bool DecoderProto::get_tensor_content(ov::PartialShape& shape, std::shared_ptr<TensorContent>& content) const {
+    if (!m_tensor_content) {
+        return false;
+    }
+    tf_shape_to_ov_shape(m_node_def->attr().at("value").tensor().tensor_shape(), &shape);
+    content = m_tensor_content;
+    return true;
+}
+
 std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
+    const auto& attr_map = m_node_def->attr();
     if (attr_map.contains(name)) {
         auto value = m_node_def->attr().at(name);
         return {value};
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "attr_value.pb.h"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "types.pb.h"
@@ -16,9 +17,15 @@ namespace ov {
 namespace frontend {
 namespace tensorflow {
 
+/// \brief View of the tensor content which is kept in the model file instead of the node definition
+using TensorContent = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    explicit DecoderProto(const ::tensorflow::NodeDef* node_def,
+                          std::shared_ptr<TensorContent> tensor_content = nullptr)
+        : m_node_def(node_def),
+          m_tensor_content(std::move(tensor_content)) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -34,9 +41,16 @@ public:
 
     const std::string& get_op_name() const override;
 
+    /// \brief Get the shape and the content of the "value" tensor of a Const node without copying the content
+    ///
+    /// \return false if the tensor content is stored in the node definition itself
+    bool get_tensor_content(ov::PartialShape& shape, std::shared_ptr<TensorContent>& content) const;
+
 private:
     std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    // the content of the "value" tensor stripped from the node definition while the graph is loaded
+    std::shared_ptr<TensorContent> m_tensor_content;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_iterator_proto.hpp"
+
+#include <limits>
+
+namespace ov {
+namespace frontend {
+namespace tensorflow {
+namespace {
+// field numbers from graph.proto, node_def.proto, attr_value.proto and tensor.proto
+constexpr uint32_t GRAPH_DEF_NODE = 1;
+constexpr uint32_t NODE_DEF_ATTR = 5;
+constexpr uint32_t ATTR_ENTRY_KEY = 1;
+constexpr uint32_t ATTR_ENTRY_VALUE = 2;
+constexpr uint32_t ATTR_VALUE_TENSOR = 8;
+constexpr uint32_t TENSOR_PROTO_TENSOR_CONTENT = 4;
+
+constexpr uint32_t WIRE_TYPE_VARINT = 0;
+constexpr uint32_t WIRE_TYPE_FIXED64 = 1;
+constexpr uint32_t WIRE_TYPE_LENGTH_DELIMITED = 2;
+constexpr uint32_t WIRE_TYPE_FIXED32 = 5;
+
+/// \brief Minimal reader of the protobuf wire format which walks over the fields of a message without parsing it
+class WireReader {
+public:
+    WireReader(const uint8_t* begin, const uint8_t* end) : m_ptr(begin), m_end(end) {}
+
+    bool is_end() const {
+        return m_ptr >= m_end;
+    }
+
+    const uint8_t* position() const {
+        return m_ptr;
+    }
+
+    /// \brief Reads the next field, [data, data + size) is set to the field payload
+    /// \return false if the message is malformed or uses the deprecated groups
+    bool next(uint32_t& field, uint32_t& wire_type, const uint8_t*& data, uint64_t& size) {
+        uint64_t tag = 0;
+        if (!read_varint(tag)) {
+            return false;
+        }
+        field = static_cast<uint32_t>(tag >> 3);
+        wire_type = static_cast<uint32_t>(tag & 0x7);
+        data = m_ptr;
+        switch (wire_type) {
+        case WIRE_TYPE_VARINT: {
+            uint64_t value = 0;
+            if (!read_varint(value)) {
+                return false;
+            }
+            size = m_ptr - data;
+            return true;
+        }
+        case WIRE_TYPE_FIXED64:
+            size = 8;
+            break;
+        case WIRE_TYPE_LENGTH_DELIMITED:
+            if (!read_varint(size)) {
+                return false;
+            }
+            data = m_ptr;
+            break;
+        case WIRE_TYPE_FIXED32:
+            size = 4;
+            break;
+        default:
+            return false;
+        }
+        if (size > static_cast<uint64_t>(m_end - m_ptr)) {
+            return false;
+        }
+        m_ptr += size;
+        return true;
+    }
+
+private:
+    bool read_varint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && m_ptr < m_end; shift += 7) {
+            const uint8_t byte = *m_ptr++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const uint8_t* m_ptr;
+    const uint8_t* m_end;
+};
+
+/// \brief Finds the last occurrence of the length-delimited field in the serialized message
+bool find_field(const uint8_t* begin,
+                const uint8_t* end,
+                uint32_t field_number,
+                const uint8_t*& field_data,
+                uint64_t& field_size) {
+    WireReader reader(begin, end);
+    bool found = false;
+    while (!reader.is_end()) {
+        uint32_t field, wire_type;
+        const uint8_t* data;
+        uint64_t size;
+        if (!reader.next(field, wire_type, data, size)) {
+            return false;
+        }
+        if (field == field_number && wire_type == WIRE_TYPE_LENGTH_DELIMITED) {
+            field_data = data;
+            field_size = size;
+            found = true;
+        }
+    }
+    return found;
+}
+
+/// \brief Locates the tensor_content bytes of the "value" attribute in the serialized NodeDef
+bool find_value_tensor_content(const uint8_t* begin,
+                               const uint8_t* end,
+                               const uint8_t*& content,
+                               uint64_t& content_size) {
+    WireReader node_reader(begin, end);
+    bool found = false;
+    while (!node_reader.is_end()) {
+        uint32_t field, wire_type;
+        const uint8_t* entry;
+        uint64_t entry_size;
+        if (!node_reader.next(field, wire_type, entry, entry_size)) {
+            return false;
+        }
+        if (field != NODE_DEF_ATTR || wire_type != WIRE_TYPE_LENGTH_DELIMITED) {
+            continue;
+        }
+        const uint8_t *key, *attr_value, *tensor;
+        uint64_t key_size, attr_value_size, tensor_size;
+        if (!find_field(entry, entry + entry_size, ATTR_ENTRY_KEY, key, key_size) || key_size != 5 ||
+            std::string(reinterpret_cast<const char*>(key), key_size) != "value") {
+            continue;
+        }
+        found = find_field(entry, entry + entry_size, ATTR_ENTRY_VALUE, attr_value, attr_value_size) &&
+                find_field(attr_value, attr_value + attr_value_size, ATTR_VALUE_TENSOR, tensor, tensor_size) &&
+                find_field(tensor, tensor + tensor_size, TENSOR_PROTO_TENSOR_CONTENT, content, content_size);
+    }
+    return found;
+}
+}  // namespace
+
+void GraphIteratorProto::load_graph_def(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& model) {
+    const auto begin = model->get_ptr<uint8_t>();
+    const auto end = begin + model->size();
+
+    // the fields of GraphDef other than the nodes (versions, library) are small, they are parsed at once
+    std::string other_fields;
+    WireReader graph_reader(begin, end);
+    while (!graph_reader.is_end()) {
+        const auto field_begin = graph_reader.position();
+        uint32_t field, wire_type;
+        const uint8_t* data;
+        uint64_t size;
+        FRONT_END_GENERAL_CHECK(graph_reader.next(field, wire_type, data, size), "Model cannot be parsed");
+        if (field != GRAPH_DEF_NODE || wire_type != WIRE_TYPE_LENGTH_DELIMITED) {
+            other_fields.append(reinterpret_cast<const char*>(field_begin), graph_reader.position() - field_begin);
+            continue;
+        }
+
+        auto node_def = m_graph_def->add_node();
+        FRONT_END_GENERAL_CHECK(size <= static_cast<uint64_t>(std::numeric_limits<int>::max()) &&
+                                    node_def->ParseFromArray(data, static_cast<int>(size)),
+                                "Model cannot be parsed");
+
+        std::shared_ptr<TensorContent> tensor_content;
+        const auto value = node_def->mutable_attr()->find("value");
+        if (node_def->op() == "Const" && value != node_def->mutable_attr()->end() && value->second.has_tensor() &&
+            !value->second.tensor().tensor_content().empty()) {
+            const uint8_t* content;
+            uint64_t content_size;
+            if (find_value_tensor_content(data, data + size, content, content_size) &&
+                content_size == value->second.tensor().tensor_content().size()) {
+                // release the parsed copy, the converter reads the content from the mapped file
+                std::unique_ptr<std::string> released(value->second.mutable_tensor()->release_tensor_content());
+                tensor_content = std::make_shared<TensorContent>(reinterpret_cast<char*>(const_cast<uint8_t*>(content)),
+                                                                 static_cast<size_t>(content_size),
+                                                                 model);
+            }
+        }
+        m_tensor_contents.push_back(std::move(tensor_content));
+    }
+    FRONT_END_GENERAL_CHECK(other_fields.empty() || m_graph_def->MergeFromString(other_fields),
+                            "Model cannot be parsed");
+
+    m_nodes.resize(m_graph_def->node_size());
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+        m_nodes[i] = &m_graph_def->node(static_cast<int>(i));
+}
+
+}  // namespace tensorflow
+}  // namespace frontend
+}  // namespace ov
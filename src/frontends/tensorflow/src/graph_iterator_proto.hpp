@@ -4,14 +4,13 @@
 
 #pragma once
 
-#include <fstream>
-
 #include "decoder_proto.hpp"
 #include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace frontend {
@@ -19,20 +18,24 @@ namespace tensorflow {
 
 class GraphIteratorProto : public GraphIterator {
     std::vector<const ::tensorflow::NodeDef*> m_nodes;
+    // the content of the Const tensors left in the memory mapped model file, nullptr for the other nodes
+    std::vector<std::shared_ptr<TensorContent>> m_tensor_contents;
     size_t node_index = 0;
     std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
 
 public:
     template <typename T>
     GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
-        std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
-
-        FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
-        FRONT_END_GENERAL_CHECK(m_graph_def->ParseFromIstream(&pb_stream), "Model cannot be parsed");
-
-        m_nodes.resize(m_graph_def->node_size());
-        for (size_t i = 0; i < m_nodes.size(); ++i)
-            m_nodes[i] = &m_graph_def->node(i);
+        std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+        try {
+            mapped_memory = ov::util::load_mmap_object(path);
+        } catch (const std::exception& e) {
+            FRONT_END_GENERAL_CHECK(false, "Model file does not exist. ", e.what());
+        }
+        load_graph_def(std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory));
     }
 
     /// Set iterator to the start position
@@ -55,8 +58,15 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_tensor_contents[node_index]);
     }
+
+private:
+    /// \brief Parses the node definitions of the memory mapped GraphDef one by one
+    ///
+    /// The content of the Const tensors is not kept in the parsed nodes, the converter gets a view into the
+    /// mapped model file instead, so the constant data is neither held twice nor copied into the Constant nodes.
+    void load_graph_def(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& model);
 };
 
 }  // namespace tensorflow
@@ -190,6 +190,19 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
 
 template <typename T, typename VecT = T>
 void make_const_op(const NodeContext& node, element::Type et, ov::Output<ov::Node>& ng_node) {
+    // the tensor content left in the memory mapped model file is shared with the Constant without copying,
+    // protobuf does not align the content, so the misaligned one is copied into the Constant's own buffer
+    if (const auto decoder = dynamic_cast<const DecoderProto*>(node.get_decoder())) {
+        ov::PartialShape pshape;
+        std::shared_ptr<TensorContent> content;
+        if (decoder->get_tensor_content(pshape, content) && pshape.is_static() &&
+            content->size() == ov::shape_size(pshape.get_shape()) * et.size() &&
+            reinterpret_cast<uintptr_t>(content->get_ptr()) % et.size() == 0) {
+            ng_node = std::make_shared<ov::opset8::Constant>(et, pshape.get_shape(), content);
+            return;
+        }
+    }
+
     std::vector<VecT> const_values;
     ov::Shape ng_shape;
 
@@ -53,6 +53,44 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables the CPU runtime parameters cache shared between the streams of the executable network pinned to the same
+ * NUMA node (set value to YES). The graphs of the streams take the compiled primitives from one cache per NUMA node, so
+ * each kernel is generated once per node. With the shared cache the capacity limits the number of records per CPU
+ * runtime parameter type for each NUMA node.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED);
+
+/**
+ * @brief Read-only executable network key that returns the CPU runtime parameters cache hits, misses and evictions
+ * counters as std::map<std::string, uint64_t>
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_STATISTICS);
+
+/**
+ * @brief Enables concurrent execution of independent graph branches within a single CPU inference request (set value to
+ * YES)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_EXECUTION);
+
+/**
+ * @brief Enables the memory planner of the dynamic shapes graphs (set value to YES). The memory of the intermediate
+ * tensors is placed into a common arena using the layout solved once per input shapes and reused by the subsequent
+ * inferences with the same input shapes.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_PLANNER);
+
+/**
+ * @brief Keeps the int8 (int4) weights of MatMul compressed and decompresses them in FullyConnected on the fly (set value
+ * to NO to decompress the weights at the model loading). Enabled by default.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_DECOMPRESSION);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
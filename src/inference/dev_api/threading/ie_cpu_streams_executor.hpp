@@ -21,6 +21,9 @@ namespace InferenceEngine {
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
  *        It uses custom threads to pull tasks from single queue.
+ * @note   If Config::_workStealing is set, every stream has its own lock-free queue for the tasks submitted from
+ *         the stream thread, the tasks of the other threads go to the shared queue, and an idle stream steals the
+ *         tasks from the queues of the other streams. There is no FIFO order of run() in this mode.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< The tasks submitted from a stream thread are queued to its stream, the idle
+                                     //!< streams steal them. The tasks do not start in the submission order
 
         /**
          * @brief      A constructor with arguments
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -25,6 +26,94 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer task queue (D. Vyukov's array based queue).
+ * Every stream thread owns one queue, the tasks are also popped from it by the other stream threads which steal work.
+ */
+class TaskRing {
+public:
+    explicit TaskRing(std::size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        assert((capacity & _mask) == 0 && "The capacity should be a power of two");
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Moves the task to the queue
+     * @return false if the queue is full, the task is left untouched in this case
+     */
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (0 == diff) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Moves the oldest task from the queue
+     * @return false if the queue is empty
+     */
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::vector<Cell> _cells;
+    const std::size_t _mask;
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos{0};
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos{0};
+    char _pad2[cacheLineSize];
+};
+
+// the work stealing executor and the index of the stream which the current thread runs
+thread_local const void* currentExecutor = nullptr;
+thread_local int currentStreamId = -1;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -68,9 +157,7 @@ struct CPUStreamsExecutor::Impl {
                 }
             }
             _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
+                              ? _impl->GetStreamNumaNodeId(_streamId)
                               : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
@@ -215,6 +302,10 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing) {
+            StartWorkStealingThreads();
+            return;
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -238,12 +329,109 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    void StartWorkStealingThreads() {
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _rings.emplace_back(new TaskRing{ringCapacity});
+        }
+        // the stream threads steal the tasks from the streams of the same NUMA node first
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            std::vector<int> stealOrder;
+            for (int sameNumaNode = 1; sameNumaNode >= 0; --sameNumaNode) {
+                for (auto victimId = 1; victimId < _config._streams; ++victimId) {
+                    const auto victim = (streamId + victimId) % _config._streams;
+                    if ((GetStreamNumaNodeId(victim) == GetStreamNumaNodeId(streamId)) == (1 == sameNumaNode)) {
+                        stealOrder.push_back(victim);
+                    }
+                }
+            }
+            _stealOrders.emplace_back(std::move(stealOrder));
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _threads.emplace_back([this, streamId] {
+                openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                currentExecutor = this;
+                currentStreamId = streamId;
+                for (bool stopped = false; !stopped;) {
+                    if (TryClaim()) {
+                        // the claimed task is already published, but it can be queued behind the one being pushed
+                        Task task;
+                        while (!TryPop(streamId, task)) {
+                            std::this_thread::yield();
+                        }
+                        Execute(task, *(_streams.local()));
+                    } else {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        ++_sleepingThreads;
+                        _queueCondVar.wait(lock, [&] {
+                            return _pendingTasks.load() > 0 || (stopped = _isStopped);
+                        });
+                        --_sleepingThreads;
+                    }
+                }
+            });
+        }
+    }
+
+    int GetStreamNumaNodeId(int streamId) const {
+        return _usedNumaNodes.at((streamId % _config._streams) /
+                                 ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()));
+    }
+
+    bool TryClaim() {
+        auto pendingTasks = _pendingTasks.load();
+        while (pendingTasks > 0) {
+            if (_pendingTasks.compare_exchange_weak(pendingTasks, pendingTasks - 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the own stream queue first, then the shared queue, then the queues of the other streams
+    bool TryPop(int streamId, Task& task) {
+        if (_rings[streamId]->TryPop(task)) {
+            return true;
+        }
+        if (_sharedTasks.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_sharedTasks;
+                return true;
+            }
+        }
+        for (auto victim : _stealOrders[streamId]) {
+            if (_rings[victim]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
-        {
+        if (!_config._workStealing) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _taskQueue.emplace(std::move(task));
+            }
+            _queueCondVar.notify_one();
+            return;
+        }
+        // the task submitted by a stream thread stays in its stream queue unless an idle stream steals it,
+        // the tasks of the other threads (or a full stream queue) go to the shared queue
+        const bool pushed = (currentExecutor == this) && _rings[currentStreamId]->TryPush(task);
+        if (!pushed) {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            ++_sharedTasks;
+        }
+        _pendingTasks.fetch_add(1);
+        // the lock is taken only to not miss the thread which is going to wait
+        if (_sleepingThreads.load() > 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -282,7 +470,16 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
+    // the FIFO queue of all the tasks, or the shared queue in the work stealing mode
     std::queue<Task> _taskQueue;
+    // the work stealing mode
+    static constexpr std::size_t ringCapacity = 1024;
+    std::vector<std::unique_ptr<TaskRing>> _rings;
+    std::vector<std::vector<int>> _stealOrders;
+    // number of the enqueued tasks which are not claimed by the stream threads yet
+    std::atomic<std::int64_t> _pendingTasks{0};
+    std::atomic_int _sleepingThreads{0};
+    std::atomic_int _sharedTasks{0};
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
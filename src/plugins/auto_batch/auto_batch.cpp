@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -384,10 +385,16 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
-            workerInferRequest._tasks.push(t);
-            // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
-            const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            int sz = 0;
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                workerInferRequest._tasks.push(t);
+                // the worker pops the tasks under the same lock, so the size is exact
+                sz = workerInferRequest._tasks.size();
+                workerInferRequest.RegisterArrival(1 == sz);
+            }
+            // the first request starts the collection window, so the worker should re-evaluate it
+            if (sz == workerInferRequest._batchSize || 1 == sz) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -424,6 +431,49 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
 }
 
 // ------------------------------AutoBatchExecutableNetwork----------------------------
+namespace {
+double UpdateAverage(double average, double value) {
+    constexpr double alpha = 0.25;
+    return average < 0 ? value : average + alpha * (value - average);
+}
+}  // namespace
+
+void AutoBatchExecutableNetwork::WorkerInferRequest::RegisterArrival(bool first) {
+    const auto now = _now();
+    if (first) {
+        _firstArrival = now;
+    } else {
+        // the gaps between the batches are not accounted, so the rate follows the bursts of the requests
+        _avgInterArrivalMs =
+            UpdateAverage(_avgInterArrivalMs, std::chrono::duration<double, std::milli>(now - _lastArrival).count());
+    }
+    _lastArrival = now;
+}
+
+void AutoBatchExecutableNetwork::WorkerInferRequest::RegisterExecution(Clock::duration time, bool batched) {
+    auto& average = batched ? _avgBatchedExecMs : _avgFallbackExecMs;
+    average = UpdateAverage(average, std::chrono::duration<double, std::milli>(time).count());
+}
+
+std::chrono::milliseconds AutoBatchExecutableNetwork::WorkerInferRequest::GetCollectionTime(
+    int collected,
+    unsigned int timeOut) const {
+    if (!collected)
+        return std::chrono::milliseconds(timeOut);
+    // the oldest collected request should not wait for the batch longer than the timeout
+    auto remaining =
+        std::chrono::duration<double, std::milli>(_firstArrival + std::chrono::milliseconds(timeOut) - _now())
+            .count();
+    // the full batch completes later than the batch1 fallback, so the collection window is shortened by the difference
+    // to keep the latency of the oldest request within the same bound
+    if (_avgBatchedExecMs > 0 && _avgFallbackExecMs > 0)
+        remaining -= std::max(0., _avgBatchedExecMs - _avgFallbackExecMs);
+    // no reason to wait if the batch is not going to be collected in time with the current arrival rate
+    if (_avgInterArrivalMs >= 0 && (_batchSize - collected) * _avgInterArrivalMs > remaining)
+        return std::chrono::milliseconds(0);
+    return std::chrono::milliseconds(std::max(0, static_cast<int>(std::ceil(remaining))));
+}
+
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
     const InferenceEngine::SoExecutableNetworkInternal& networkWithoutBatch,
@@ -509,6 +559,11 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                {
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                    workerRequestPtr->RegisterExecution(
+                        workerRequestPtr->_now() - workerRequestPtr->_batchedStart, true);
+                }
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -520,36 +575,48 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
             while (1) {
-                std::cv_status status;
+                bool collectionIsOver = false;
+                std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    // the waiting time adapts to the arrival rate of the requests, see the GetCollectionTime
+                    workerRequestPtr->_cond.wait_for(
+                        lock,
+                        workerRequestPtr->GetCollectionTime(workerRequestPtr->_tasks.size(), _timeOut));
+                    collectionIsOver =
+                        0 == workerRequestPtr->GetCollectionTime(workerRequestPtr->_tasks.size(), _timeOut).count();
+                    // the tasks are popped under the same lock they are pushed with,
+                    // so the requests always see the exact number of the collected tasks
+                    const int sz = workerRequestPtr->_tasks.size();
+                    if (!_terminate && (sz == workerRequestPtr->_batchSize || (collectionIsOver && sz))) {
+                        tasks.resize(sz);
+                        for (auto& t : tasks) {
+                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        }
+                    }
                 }
                 if (_terminate) {
                     break;
                 } else {
-                    // as we pop the tasks from the queue only here
-                    // it is ok to call size() (as the _tasks can only grow in parallel)
-                    const int sz = workerRequestPtr->_tasks.size();
+                    const int sz = static_cast<int>(tasks.size());
                     if (sz == workerRequestPtr->_batchSize) {
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            auto& t = tasks[n];
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
                             t.first->_inferRequest->CopyInputsIfNeeded();
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batchedStart = workerRequestPtr->_now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                    } else if (sz) {
+                        // time to collect the batch is over, have to execute the requests in the batch1 mode
+                        // all tasks collected by the moment of the time-out are executed each with batch1
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        const auto fallbackStart = workerRequestPtr->_now();
+                        for (const auto& t : tasks) {
                             t.first->_inferRequestWithoutBatch->SetCallback(
                                 [t, sz, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
@@ -564,6 +631,10 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequestWithoutBatch->StartAsync();
                         }
                         all_completed_future.get();
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                            workerRequestPtr->RegisterExecution(workerRequestPtr->_now() - fallbackStart, false);
+                        }
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <string>
@@ -43,6 +45,23 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+
+        // Adaptive batch collection window. The statistics below are guarded by the _mutex
+        using Clock = std::chrono::steady_clock;
+        // registers the request arrival, the first one starts the collection of the next batch
+        void RegisterArrival(bool first);
+        // registers the execution time of the batched request (or of the batch1 fallback for the collected requests)
+        void RegisterExecution(Clock::duration time, bool batched);
+        // time left to collect the batch, zero if the batch can't be collected in time and should be executed now
+        std::chrono::milliseconds GetCollectionTime(int collected, unsigned int timeOut) const;
+        // the time source of the collection window, replaced by the tests
+        std::function<Clock::time_point()> _now = Clock::now;
+        Clock::time_point _firstArrival;
+        Clock::time_point _lastArrival;
+        double _avgInterArrivalMs = -1.;
+        double _avgBatchedExecMs = -1.;
+        double _avgFallbackExecMs = -1.;
+        Clock::time_point _batchedStart;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "cache_entry.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Thread safe version of the CacheEntry.
+ * The records are distributed over several shards by the key hash, each shard has its own storage and lock, so concurrent
+ * lookups of different keys rarely contend. Concurrent misses on the same key are deduplicated: the value is built only by
+ * the first caller, the others wait for the result and get it with the Hit status.
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type and must be copy constructible
+ * @tparam ImplType is a type for the shard storage with the same requirements as for the CacheEntry ImplType
+ *
+ * @note In this implementation default constructed value objects are treated as empty objects.
+ */
+
+template<typename KeyType,
+         typename ValType,
+         typename ImplType = LruCache<KeyType, ValType>>
+class ConcurrentCacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+    static constexpr size_t shardsCount = 16;
+
+public:
+    /**
+     * @param capacity is the total records limit, it is evenly distributed over the shards
+     */
+    explicit ConcurrentCacheEntry(size_t capacity) : _capacity(capacity) {
+        const size_t shardCapacity = (capacity + shardsCount - 1) / shardsCount;
+        _shards.reserve(shardsCount);
+        for (size_t i = 0; i < shardsCount; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, waits for the value if it is being created
+     *        by another thread, or creates a value using the builder functor and adds it to the underlying storage.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+     */
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _capacity) {
+            // fast track
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
+
+        auto& shard = *_shards[key.hash() % shardsCount];
+        std::unique_lock<std::mutex> lock(shard.guard);
+
+        ValType retVal = shard.impl.get(key);
+        const auto retEmpty = ValType();
+        if (retVal != retEmpty) {
+            return {retVal, LookUpStatus::Hit};
+        }
+
+        auto inFlightItr = shard.inFlight.find(key);
+        if (inFlightItr != shard.inFlight.end()) {
+            auto future = inFlightItr->second;
+            lock.unlock();
+            return {future.get(), LookUpStatus::Hit};
+        }
+
+        std::promise<ValType> promise;
+        shard.inFlight.insert({key, promise.get_future().share()});
+        lock.unlock();
+
+        try {
+            retVal = builder(key);
+        } catch (...) {
+            lock.lock();
+            shard.inFlight.erase(key);
+            lock.unlock();
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        lock.lock();
+        if (retVal != retEmpty)
+            shard.impl.put(key, retVal);
+        shard.inFlight.erase(key);
+        lock.unlock();
+
+        promise.set_value(retVal);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+    size_t getEvictionsCount() const override {
+        size_t count = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->guard);
+            count += shard->impl.getEvictionsCount();
+        }
+        return count;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const KeyType &k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : impl(capacity) {}
+
+        mutable std::mutex guard;
+        ImplType impl;
+        std::unordered_map<KeyType, std::shared_future<ValType>, key_hasher> inFlight;
+    };
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -7,7 +7,10 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
+#include <vector>
 #include "cache_entry.h"
+#include "concurrent_cache_entry.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,23 +18,39 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default this implementation IS NOT THREAD SAFE! The thread safe mode uses ConcurrentCacheEntry records
+ *            storages, so the cache may be shared between several graphs executed in parallel.
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = ConcurrentCacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
+    struct Statistics {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+    };
+
+    // number of the key/value types whose entries are looked up without locking
+    static constexpr size_t maxEntryTypes = 256;
+
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe enables the thread safe mode
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    MultiCache(const MultiCache&) = delete;
+    MultiCache& operator=(const MultiCache&) = delete;
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,20 +64,46 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto result = _threadSafe ? getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>()->getOrCreate(key, std::move(builder))
+                                  : getEntry<EntryTypeT<KeyType, ValueType>>()->getOrCreate(key, std::move(builder));
+        if (CacheEntryBase::LookUpStatus::Hit == result.second) {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    /**
+    * @brief Returns the lookups statistics accumulated over all the entries since the cache creation
+    */
+    Statistics getStatistics() const {
+        Statistics statistics{_hits.load(std::memory_order_relaxed), _misses.load(std::memory_order_relaxed), 0};
+        std::lock_guard<std::mutex> lock(_creationGuard);
+        for (const auto& entry : _owners) {
+            statistics.evictions += entry->getEvictionsCount();
+        }
+        return statistics;
     }
 
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    EntryType* getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
-    std::unordered_map<size_t, EntryBasePtr> _storage;
+    bool _threadSafe;
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    // entries are looked up by the type id without locking, the lock is taken only to create a new entry
+    std::atomic<CacheEntryBase*> _entries[maxEntryTypes] = {};
+    // entries of the type ids beyond the table, looked up under the lock
+    std::unordered_map<size_t, CacheEntryBase*> _overflowEntries;
+    mutable std::mutex _creationGuard;
+    std::vector<EntryBasePtr> _owners;
 };
 
 template<typename T>
@@ -67,16 +112,29 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+EntryType* MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
-    auto itr = _storage.find(id);
-    if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
-        itr = result.first;
+    if (id >= maxEntryTypes) {
+        std::lock_guard<std::mutex> lock(_creationGuard);
+        auto& entry = _overflowEntries[id];
+        if (nullptr == entry) {
+            _owners.push_back(std::make_shared<EntryType>(_capacity));
+            entry = _owners.back().get();
+        }
+        return static_cast<EntryType*>(entry);
+    }
+    auto entry = _entries[id].load(std::memory_order_acquire);
+    if (nullptr == entry) {
+        std::lock_guard<std::mutex> lock(_creationGuard);
+        entry = _entries[id].load(std::memory_order_relaxed);
+        if (nullptr == entry) {
+            _owners.push_back(std::make_shared<EntryType>(_capacity));
+            entry = _owners.back().get();
+            _entries[id].store(entry, std::memory_order_release);
+        }
     }
-    return std::static_pointer_cast<EntryType>(itr->second);
+    return static_cast<EntryType*>(entry);
 }
 
 using MultiCachePtr = std::shared_ptr<MultiCache>;
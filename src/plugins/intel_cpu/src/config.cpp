@@ -148,6 +148,38 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED == key) {
+            if (val == PluginConfigParams::YES)
+                rtCacheShared = true;
+            else if (val == PluginConfigParams::NO)
+                rtCacheShared = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION == key) {
+            if (val == PluginConfigParams::YES)
+                parallelGraphExecution = true;
+            else if (val == PluginConfigParams::NO)
+                parallelGraphExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_PLANNER == key) {
+            if (val == PluginConfigParams::YES)
+                dynamicMemoryPlanner = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicMemoryPlanner = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_PLANNER
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION == key) {
+            if (val == PluginConfigParams::YES)
+                weightsDecompression = true;
+            else if (val == PluginConfigParams::NO)
+                weightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -237,6 +269,9 @@ void Config::readDebugCapsProperties() {
     if (envVarValue = readEnv("OV_CPU_VERBOSE"))
         verbose = envVarValue;
 
+    if (envVarValue = readEnv("OV_CPU_REFERENCE_REPORT"))
+        referenceReport = envVarValue;
+
     if (envVarValue = readEnv("OV_CPU_BLOB_DUMP_DIR"))
         blobDumpDir = envVarValue;
 
@@ -255,8 +290,8 @@ void Config::readDebugCapsProperties() {
     if (envVarValue = readEnv("OV_CPU_BLOB_DUMP_NODE_NAME"))
         blobDumpFilters[BY_NAME] = envVarValue;
 
-    // always enable perf counters for verbose mode
-    if (!verbose.empty())
+    // always enable perf counters for verbose mode and the reference report
+    if (!verbose.empty() || !referenceReport.empty())
         collectPerfCounters = true;
 }
 #endif // CPU_DEBUG_CAPS
@@ -28,6 +28,10 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool rtCacheShared = false;
+    bool parallelGraphExecution = false;
+    bool dynamicMemoryPlanner = false;
+    bool weightsDecompression = true;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -61,6 +65,7 @@ struct Config {
 
     std::string execGraphPath;
     std::string verbose;
+    std::string referenceReport;
     std::string blobDumpDir = "mkldnn_dump";
     FORMAT blobDumpFormat = FORMAT::TEXT;
     // std::hash<int> is necessary for Ubuntu-16.04 (gcc-5.4 and defect in C++11 standart)
@@ -139,6 +139,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "ShuffleChannels", Type::ShuffleChannels},
         { "DFT", Type::DFT},
         { "IDFT", Type::DFT},
+        { "RDFT", Type::RDFT},
+        { "IRDFT", Type::RDFT},
         { "Abs", Type::Math},
         { "Acos", Type::Math},
         { "Acosh", Type::Math},
@@ -322,6 +324,8 @@ std::string NameFromType(const Type type) {
             return "ShuffleChannels";
         case Type::DFT:
             return "DFT";
+        case Type::RDFT:
+            return "RDFT";
         case Type::Math:
             return "Math";
         case Type::CTCLoss:
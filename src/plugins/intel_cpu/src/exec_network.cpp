@@ -24,6 +24,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -68,12 +69,14 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
                          NumaNodesWeights &numaNodesWeights,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const CompiledConstants::CPtr& compiledConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
+    _compiledConstants(compiledConstants),
     _network(network) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
@@ -104,6 +107,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        // the infer requests do not depend on the order of their tasks
+        streamsExecutorConfig._workStealing = true;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -135,6 +140,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    _compiledConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -170,6 +176,17 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     }
     auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
+        MultiCachePtr rtParamsCache;
+        if (_cfg.rtCacheShared && _graphs.size() > 1) {
+            // the graphs of the NUMA node are compiled concurrently: the first graph building a primitive puts it into
+            // the shared cache, the others needing the same primitive wait for it there and don't generate the kernel
+            std::lock_guard<std::mutex> lock{_numaRtParamsCachesMutex};
+            auto& numaRtParamsCache = _numaRtParamsCaches[numaNodeId];
+            if (!numaRtParamsCache) {
+                numaRtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+            }
+            rtParamsCache = numaRtParamsCache;
+        }
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
@@ -177,6 +194,8 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setCompiledConstants(_compiledConstants);
+                graphLock._graph.setSharedRuntimeCache(rtParamsCache);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -275,6 +294,12 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_STATISTICS) {
+        // covers all the streams of the NUMA node if the cache is shared, otherwise only the graph of the current stream
+        const auto statistics = graph.getRuntimeCache()->getStatistics();
+        return std::map<std::string, uint64_t>{{"hits", statistics.hits},
+                                               {"misses", statistics.misses},
+                                               {"evictions", statistics.evictions}};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -541,6 +566,17 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // the constants are taken from a graph which is already compiled, so the export never compiles one
+    Graph emptyGraph;
+    for (auto& g : _graphs) {
+        auto graphLock = GraphGuard::Lock(g);
+        if (graphLock._graph.IsReady()) {
+            CompiledConstantsSerializer(modelStream) << graphLock._graph;
+            return;
+        }
+    }
+    CompiledConstantsSerializer(modelStream) << emptyGraph;
 }
 
 }   // namespace intel_cpu
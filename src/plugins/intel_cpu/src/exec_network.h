@@ -36,7 +36,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const CompiledConstants::CPtr& compiledConstants = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -68,6 +69,11 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // constant edges data of the imported network, released as soon as the stream graphs are created
+    CompiledConstants::CPtr                     _compiledConstants;
+    // runtime parameters caches shared by the graphs of the streams pinned to the same NUMA node, if enabled
+    mutable std::mutex                          _numaRtParamsCachesMutex;
+    mutable std::map<int, MultiCachePtr>        _numaRtParamsCaches;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
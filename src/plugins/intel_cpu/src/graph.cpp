@@ -33,6 +33,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
@@ -40,6 +41,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "utils/reference_report.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <ngraph/node.hpp>
@@ -49,6 +51,7 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -62,6 +65,10 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 mkldnn::engine Graph::eng(mkldnn::engine::kind::cpu, 0);
 
+Graph::~Graph() {
+    CPU_DEBUG_CAP_ENABLE(printReferenceReport(*this));
+}
+
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
         WeightsSharing::Ptr &w_cache) {
@@ -72,7 +79,7 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = sharedRtParamsCache ? sharedRtParamsCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -404,6 +411,7 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+    compiledConstants.reset();
 }
 
 void Graph::InitNodes() {
@@ -460,6 +468,20 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (!parallelExecution)
+        return;
+
+    for (const auto& node : executableGraphNodes) {
+        const size_t stage = static_cast<size_t>(nodeStages.at(node.get()));
+        if (executableStages.size() <= stage)
+            executableStages.resize(stage + 1);
+        executableStages[stage].push_back(node);
+    }
+    // stages that contain only non-executable nodes do not need to be visited during inference
+    executableStages.erase(std::remove_if(executableStages.begin(), executableStages.end(),
+                                          [](const std::vector<NodePtr>& stage) { return stage.empty(); }),
+                           executableStages.end());
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -490,7 +512,12 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    const auto restoredNodes = RestoreCompiledConstants();
+
     for (const auto &node : constantGraphNodes) {
+        if (restoredNodes.count(node.get()))
+            continue;
+
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -506,6 +533,49 @@ void Graph::ExecuteConstantNodesOnly() const {
     }
 }
 
+std::unordered_set<const Node*> Graph::RestoreCompiledConstants() const {
+    std::unordered_set<const Node*> restoredNodes;
+    if (!compiledConstants)
+        return restoredNodes;
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::RestoreCompiledConstants");
+
+    std::unordered_set<EdgePtr> restoredEdges;
+    for (const auto &node : constantGraphNodes) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            if (edge->getChild()->isConstant())
+                continue;
+
+            if (weightsCache && edge->isUseExternalMemory()) {
+                auto sharedMemory = weightsCache->get(edge->name());
+                // the data may be already computed by the graph of another stream
+                if (sharedMemory->isValid() || compiledConstants->restore(edge)) {
+                    sharedMemory->valid(true);
+                    restoredEdges.insert(edge);
+                }
+            } else if (compiledConstants->restore(edge)) {
+                restoredEdges.insert(edge);
+            }
+        }
+    }
+
+    // a constant node may be skipped only if all its consumers either got the restored data or are skipped too
+    for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+        const auto& node = *it;
+        bool isRequired = false;
+        for (size_t i = 0; i < node->getChildEdges().size() && !isRequired; i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto child = edge->getChild();
+            isRequired = child->isConstant() ? !restoredNodes.count(child.get()) : !restoredEdges.count(edge);
+        }
+        if (!isRequired)
+            restoredNodes.insert(node.get());
+    }
+
+    return restoredNodes;
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const mkldnn::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -656,6 +726,74 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+void Graph::ResolveExecutionStages() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ResolveExecutionStages");
+
+    nodeStages.clear();
+    executableStages.clear();
+    stageStreams.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // nested parallel regions are efficient only with TBB, the dynamic nodes are not supported since
+    // they reallocate memory and use the runtime cache during inference
+    parallelExecution = config.parallelGraphExecution && !graphHasDynamicInput &&
+                        std::none_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+                            return node->isDynamicNode();
+                        });
+#else
+    parallelExecution = false;
+#endif
+    if (!parallelExecution)
+        return;
+
+    auto getRootEdge = [](EdgePtr edge) {
+        while (auto sharedEdge = edge->getSharedEdge(std::nothrow))
+            edge = sharedEdge;
+        return edge;
+    };
+
+    // The stage of a node is the earliest one that keeps the sequential (topological) execution semantic:
+    //  - after all its non constant parents (RAW);
+    //  - after all the nodes that have read the memory the node writes to (WAR), that covers in-place nodes;
+    //  - after the previous node that accesses a state, since the states are not tracked by the edges.
+    // The stages are also used as the timestamps of the memory solver boxes, so the edges which memory is
+    // reused by the solver are never alive within the same stage.
+    std::unordered_map<EdgePtr, int> lastReadStage;
+    int lastStateStage = -1;
+
+    for (const auto& node : graphNodes) {
+        int stage = 0;
+        if (!node->isConstant()) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parent = node->getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant())
+                    stage = std::max(stage, nodeStages.at(parent.get()) + 1);
+            }
+
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                auto readIt = lastReadStage.find(getRootEdge(node->getChildEdgeAt(i)));
+                if (readIt != lastReadStage.end())
+                    stage = std::max(stage, readIt->second + 1);
+            }
+
+            if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+                stage = std::max(stage, lastStateStage + 1);
+                lastStateStage = stage;
+            }
+
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto& readStage = lastReadStage[getRootEdge(node->getParentEdgeAt(i))];
+                readStage = std::max(readStage, stage);
+            }
+        }
+        nodeStages[node.get()] = stage;
+    }
+}
+
+int Graph::getExecTimestamp(const NodePtr& node) const {
+    return parallelExecution ? nodeStages.at(node.get()) : node->execIndex;
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -694,8 +832,8 @@ void Graph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecTimestamp(edge->getParent());
+            int e_finish = getExecTimestamp(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -771,6 +909,9 @@ void Graph::Allocate() {
     //   NotAllocated - view on other blob, peer or in-place
     for (auto& edge : graphEdges) edge->init();
 
+    // Group nodes into execution stages if parallel execution is enabled
+    ResolveExecutionStages();
+
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
@@ -782,6 +923,142 @@ void Graph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    InitDynamicMemoryPlanner();
+}
+
+size_t Graph::InputShapesSignature::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& d : dims) {
+        seed = get_vector_hash(seed, d);
+    }
+    return seed;
+}
+
+bool Graph::InputShapesSignature::operator==(const InputShapesSignature& rhs) const {
+    return dims == rhs.dims;
+}
+
+void Graph::InitDynamicMemoryPlanner() {
+    dynamicMemoryGroups.clear();
+    dynamicMemoryPlans.reset();
+    dynamicMemoryArena.reset();
+    currentSignature = {};
+    currentSignaturePlanned = false;
+
+    if (!config.dynamicMemoryPlanner)
+        return;
+
+    // Only the intermediate tensors are planned: the memory of the inputs and outputs may be provided by the user,
+    // the constant data must stay untouched and the static edges are already placed into the workspace.
+    std::unordered_map<DnnlMemoryMngr*, size_t> groupIndices;
+    std::unordered_set<DnnlMemoryMngr*> excluded;
+    for (const auto& edge : graphEdges) {
+        auto mngr = edge->getMemory().getDnnlMemoryMngr();
+        if (!mngr)
+            continue;
+
+        const auto& parent = edge->getParent();
+        const auto& child = edge->getChild();
+        if (edge->hasDefinedMaxSize() || parent->isConstant() ||
+            one_of(parent->getType(), Type::Input, Type::MemoryInput) || child->getType() == Type::Output) {
+            excluded.insert(mngr.get());
+            continue;
+        }
+
+        auto it = groupIndices.find(mngr.get());
+        if (it == groupIndices.end()) {
+            it = groupIndices.emplace(mngr.get(), dynamicMemoryGroups.size()).first;
+            dynamicMemoryGroups.push_back({mngr, {}, std::numeric_limits<int>::max(), 0});
+        }
+        auto& group = dynamicMemoryGroups[it->second];
+        group.edges.push_back(edge);
+        group.start = std::min(group.start, getExecTimestamp(parent));
+        group.finish = std::max(group.finish, getExecTimestamp(child));
+    }
+
+    dynamicMemoryGroups.erase(std::remove_if(dynamicMemoryGroups.begin(), dynamicMemoryGroups.end(),
+                                             [&](const DynamicMemoryGroup& group) {
+                                                 return excluded.count(group.mngr.get());
+                                             }),
+                              dynamicMemoryGroups.end());
+
+    if (!dynamicMemoryGroups.empty()) {
+        constexpr size_t plansCacheCapacity = 64;
+        dynamicMemoryPlans = std::make_shared<LruCache<InputShapesSignature, DynamicMemoryPlanCPtr>>(plansCacheCapacity);
+    }
+}
+
+bool Graph::ApplyDynamicMemoryPlan() {
+    InputShapesSignature signature;
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        if (node->getChildEdges().empty())
+            continue;
+        signature.dims.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+    }
+
+    if (currentSignaturePlanned && signature == currentSignature)
+        return false;
+
+    auto plan = dynamicMemoryPlans->get(signature);
+    currentSignature = std::move(signature);
+    currentSignaturePlanned = plan != nullptr;
+    if (!plan) {
+        // the memory of the groups grows individually during this inference, the plan is solved afterwards
+        return true;
+    }
+
+    if (!dynamicMemoryArena || dynamicMemoryArena->GetSize() < plan->totalSize) {
+        dynamicMemoryArena = std::make_shared<Memory>(eng);
+        dynamicMemoryArena->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{plan->totalSize})));
+    }
+
+    // A group exceeding the planned size (e.g. a data dependent shape) is moved to an individual allocation by the
+    // memory manager on resize, so the layout stays valid for any shapes.
+    auto* arena = static_cast<int8_t*>(dynamicMemoryArena->GetData());
+    for (size_t i = 0; i < dynamicMemoryGroups.size(); i++) {
+        dynamicMemoryGroups[i].mngr->setExtBuff(arena + plan->offsets[i], plan->sizes[i]);
+        // the nodes may keep the pointers to the released buffers even if their shapes are not changed
+        for (const auto& edge : dynamicMemoryGroups[i].edges) {
+            edge->getParent()->resetLastInputDims();
+            edge->getChild()->resetLastInputDims();
+        }
+    }
+    return false;
+}
+
+void Graph::RecordDynamicMemoryPlan() {
+    const int64_t alignment = 32;  // 32 bytes
+
+    std::vector<MemorySolver::Box> boxes(dynamicMemoryGroups.size());
+    for (size_t i = 0; i < dynamicMemoryGroups.size(); i++) {
+        const auto& group = dynamicMemoryGroups[i];
+        int64_t size = 0;
+        for (const auto& edge : group.edges) {
+            const auto& desc = edge->getMemory().getDesc();
+            // the plan must cover all the groups, otherwise the groups are left to grow individually
+            if (!desc.isDefined())
+                return;
+            size = std::max(size, static_cast<int64_t>(desc.getCurrentMemSize()));
+        }
+        boxes[i] = { group.start, group.finish, div_up(size, alignment), static_cast<int64_t>(i) };
+    }
+
+    MemorySolver memSolver(boxes);
+    auto plan = std::make_shared<DynamicMemoryPlan>();
+    plan->totalSize = static_cast<size_t>(memSolver.solve()) * alignment;
+    plan->offsets.resize(boxes.size());
+    plan->sizes.resize(boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        plan->offsets[i] = static_cast<size_t>(memSolver.getOffset(static_cast<int>(i))) * alignment;
+        plan->sizes[i] = static_cast<size_t>(boxes[i].size) * alignment;
+    }
+
+    dynamicMemoryPlans->put(currentSignature, plan);
 }
 
 void Graph::CreatePrimitives() {
@@ -958,17 +1235,50 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    const bool recordMemoryPlan = !dynamicMemoryGroups.empty() && ApplyDynamicMemoryPlan();
+
+    if (parallelExecution) {
+        // a stream per worker thread of the arena, created on the first inference only
+        const auto workersNum = static_cast<size_t>(parallel_get_max_threads());
+        while (stageStreams.size() < workersNum)
+            stageStreams.emplace_back(eng);
+
+        for (const auto& stage : executableStages) {
+            if (request)
+                request->ThrowIfCanceled();
+
+            parallel_for(stage.size(), [&](size_t i) {
+                const auto& node = stage[i];
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+                // the node waiting for its nested parallel regions must not take another node of the stage on the
+                // same thread, the nodes would share the stream of the thread
+                tbb::this_task_arena::isolate([&] {
+                    ExecuteNode(node, stageStreams[parallel_get_thread_num()]);
+                });
+#else
+                ExecuteNode(node, stageStreams[parallel_get_thread_num()]);
+#endif
+            });
+        }
+    } else {
+        mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
     }
 
+    if (recordMemoryPlan)
+        RecordDynamicMemoryPlan();
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -11,7 +11,11 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
+#include "serialize.h"
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -34,6 +38,7 @@ public:
     };
 
     Graph() = default;
+    ~Graph();
 
     Status GetStatus() {
         return status;
@@ -49,6 +54,26 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the constant edges data stored in the imported blob.
+     * The constant subgraphs producing the restored data are not executed during the graph creation.
+     */
+    void setCompiledConstants(const CompiledConstants::CPtr& constants) {
+        compiledConstants = constants;
+    }
+
+    /**
+     * @brief Sets the thread safe runtime parameters cache shared with the graphs of the other streams.
+     * A graph specific cache is created if the shared one is not set.
+     */
+    void setSharedRuntimeCache(const MultiCachePtr& cache) {
+        sharedRtParamsCache = cache;
+    }
+
+    MultiCacheCPtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -237,10 +262,12 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void ResolveExecutionStages();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    std::unordered_set<const Node*> RestoreCompiledConstants() const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -258,7 +285,53 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // when parallel execution is enabled, executable nodes are grouped into stages: nodes of one stage have
+    // neither data nor memory dependencies between each other and may be executed concurrently
+    bool parallelExecution = false;
+    std::unordered_map<const Node*, int> nodeStages;
+    std::vector<std::vector<NodePtr>> executableStages;
+    // the streams of the workers executing the stages, indexed by the thread index within the arena
+    std::vector<mkldnn::stream> stageStreams;
+
+    int getExecTimestamp(const NodePtr& node) const;
+
     MultiCachePtr rtParamsCache;
+    MultiCachePtr sharedRtParamsCache;
+
+    CompiledConstants::CPtr compiledConstants;
+
+    // the dynamic memory planner: the edges with undefined max size sharing the same memory manager form a group,
+    // the groups are placed into one growable arena using the layout solved once per the input shapes signature
+    struct DynamicMemoryGroup {
+        DnnlMemoryMngrPtr mngr;
+        std::vector<EdgePtr> edges;
+        int start;
+        int finish;
+    };
+
+    struct InputShapesSignature {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesSignature& rhs) const;
+    };
+
+    struct DynamicMemoryPlan {
+        std::vector<size_t> offsets;  // in bytes from the beginning of the arena
+        std::vector<size_t> sizes;    // in bytes
+        size_t totalSize = 0;
+    };
+    using DynamicMemoryPlanCPtr = std::shared_ptr<const DynamicMemoryPlan>;
+
+    std::vector<DynamicMemoryGroup> dynamicMemoryGroups;
+    std::shared_ptr<LruCache<InputShapesSignature, DynamicMemoryPlanCPtr>> dynamicMemoryPlans;
+    InputShapesSignature currentSignature;
+    bool currentSignaturePlanned = false;
+    MemoryPtr dynamicMemoryArena;
+
+    void InitDynamicMemoryPlanner();
+    bool ApplyDynamicMemoryPlan();
+    void RecordDynamicMemoryPlan();
 
     void EnforceBF16();
 };
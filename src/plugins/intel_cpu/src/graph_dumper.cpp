@@ -18,6 +18,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <algorithm>
 
 using namespace InferenceEngine;
 
@@ -163,6 +164,10 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         }
 
         auto meta_data = extract_node_metadata(node);
+        // the stage of the concurrent execution, the nodes of one stage may be executed in parallel
+        if (graph.parallelExecution &&
+            std::find(graph.executableGraphNodes.begin(), graph.executableGraphNodes.end(), node) != graph.executableGraphNodes.end())
+            meta_data["execStage"] = std::to_string(graph.nodeStages.at(node.get()));
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
@@ -20,6 +20,8 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
+#include "nodes/embedding_bag_sum.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -47,6 +49,8 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <functional>
+#include <numeric>
 
 #include "itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -61,7 +65,15 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingAndTableDecompression");
+    FuseEmbeddingAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -149,6 +161,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvertAndEltwise");
+    FuseConvertAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "reshapeRnnSeq");
     reshapeRnnSeq(graph);
     graph.RemoveDroppedNodes();
@@ -659,6 +675,231 @@ static bool BF16QuantizeNodeFusing(const NodePtr& parentNode, const NodePtr& chi
             childNode->getOriginalOutputPrecisionAtPort(0));
 }
 
+/**
+ * The weights kept compressed by MarkWeightsDecompression come to FullyConnected through the decompression subgraph
+ * Input(u8/i8) -> Convert -> [Reshape [O, G, K / G]] -> [Subtract(zero points)] -> Multiply(scales) -> [Reshape [O, K]]
+ * built by ConvertMatMulToFC. The subgraph is fused into FullyConnected, so the weights stay in 8 bits in memory.
+ */
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableFCNode = [](const NodePtr& node) {
+        return node->getType() == Type::FullyConnected &&
+               one_of(node->getInputShapeAtPort(0).getRank(), 2, 3) &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16) &&
+               node->getFusedWith().empty();
+    };
+
+    auto isSuitableChainNode = [](const NodePtr& node, Type type, Algorithm algorithm = Algorithm::Default) {
+        return node->getType() == type &&
+               (algorithm == Algorithm::Default || node->getAlgorithm() == algorithm) &&
+               node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty();
+    };
+
+    // the scales (zero points) of the shape [O, 1] or [O, G, 1]
+    auto readParams = [](const NodePtr& node, size_t O, std::vector<float>& params) {
+        auto* constNode = dynamic_cast<node::Input*>(node.get());
+        if (constNode == nullptr || !node->isConstant() || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+
+        const auto& dims = node->getOutputShapeAtPort(0).getStaticDims();
+        if (dims.size() < 2 || dims[0] != O || dims.back() != 1)
+            return false;
+
+        const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        const auto* data = static_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+        params.assign(data, data + size);
+        return true;
+    };
+
+    auto dropChainNode = [&graph](const NodePtr& node) {
+        std::vector<EdgePtr> constEdges;
+        for (size_t i = 1; i < node->getParentEdges().size(); i++)
+            constEdges.push_back(node->getParentEdgesAtPort(i)[0]);
+        for (auto& edge : constEdges)
+            graph.RemoveEdge(edge);
+        graph.DropNode(node);
+    };
+
+    for (const auto& fc : graphNodes) {
+        if (!isSuitableFCNode(fc))
+            continue;
+
+        std::vector<NodePtr> chain;
+        auto node = fc->getParentEdgesAtPort(1)[0]->getParent();
+        const bool grouped = node->getType() == Type::Reshape;
+        if (grouped) {
+            if (!isSuitableChainNode(node, Type::Reshape))
+                continue;
+            chain.push_back(node);
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (!isSuitableChainNode(node, Type::Eltwise, Algorithm::EltwiseMultiply) || node->getParentEdges().size() != 2)
+            continue;
+        chain.push_back(node);
+        const auto scalesNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        node = node->getParentEdgesAtPort(0)[0]->getParent();
+
+        NodePtr zeroPointsNode;
+        if (node->getType() == Type::Eltwise) {
+            if (!isSuitableChainNode(node, Type::Eltwise, Algorithm::EltwiseSubtract) || node->getParentEdges().size() != 2)
+                continue;
+            chain.push_back(node);
+            zeroPointsNode = node->getParentEdgesAtPort(1)[0]->getParent();
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        NodePtr groupsReshape;
+        if (grouped) {
+            if (!isSuitableChainNode(node, Type::Reshape))
+                continue;
+            chain.push_back(node);
+            groupsReshape = node;
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (!isSuitableChainNode(node, Type::Convert))
+            continue;
+        chain.push_back(node);
+
+        const auto weightsNode = node->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (weightsNode->getType() != Type::Input || !weightsNode->isConstant() ||
+            !one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        const auto& weightsDims = weightsNode->getOutputShapeAtPort(0).getStaticDims();
+        if (weightsDims.size() != 2 || weightsDims != fc->getInputShapeAtPort(1).getStaticDims())
+            continue;
+        const size_t O = weightsDims[0];
+        const size_t K = weightsDims[1];
+
+        std::vector<float> scales;
+        if (!readParams(scalesNode, O, scales))
+            continue;
+        const size_t G = scales.size() / O;
+        if (K % G != 0 || (!grouped && G != 1))
+            continue;
+        if (grouped && groupsReshape->getOutputShapeAtPort(0).getStaticDims() != VectorDims{O, G, K / G})
+            continue;
+
+        std::vector<float> zeroPoints;
+        if (zeroPointsNode && (!readParams(zeroPointsNode, O, zeroPoints) || zeroPoints.size() != scales.size()))
+            continue;
+
+        auto fcNode = std::dynamic_pointer_cast<FullyConnected>(fc);
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot cast " << fc->getName() << " to FullyConnected node";
+        fcNode->setWeightsDecompression(std::move(scales), std::move(zeroPoints), K / G);
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+
+        for (const auto& chainNode : chain)
+            dropChainNode(chainNode);
+    }
+}
+
+/**
+ * The int8 embedding tables kept compressed by MarkEmbeddingTableDecompression come to the embedding nodes through
+ * the decompression subgraph Input(u8/i8) -> Convert -> [Subtract(zero points)] -> Multiply(scales).
+ * The subgraph is fused into the embedding node, so the table stays in 8 bits in memory.
+ */
+void GraphOptimizer::FuseEmbeddingAndTableDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableEmbeddingNode = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::EmbeddingBagOffsetsSum, Type::EmbeddingBagPackedSum, Type::EmbeddingSegmentsSum) &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16) &&
+               node->getFusedWith().empty();
+    };
+
+    auto isSuitableChainNode = [](const NodePtr& node, Type type, Algorithm algorithm = Algorithm::Default) {
+        return node->getType() == type &&
+               (algorithm == Algorithm::Default || node->getAlgorithm() == algorithm) &&
+               node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty();
+    };
+
+    // the scales (zero points) of the shape [N, 1, ..., 1] or of a single element
+    auto readParams = [](const NodePtr& node, const VectorDims& tableDims, std::vector<float>& params) {
+        auto* constNode = dynamic_cast<node::Input*>(node.get());
+        if (constNode == nullptr || !node->isConstant() || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+
+        const auto& dims = node->getOutputShapeAtPort(0).getStaticDims();
+        const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        if (size != 1 && (dims.size() != tableDims.size() || dims[0] != tableDims[0] || size != tableDims[0]))
+            return false;
+
+        const auto* data = static_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+        params.assign(data, data + size);
+        return true;
+    };
+
+    auto dropChainNode = [&graph](const NodePtr& node) {
+        std::vector<EdgePtr> constEdges;
+        for (size_t i = 1; i < node->getParentEdges().size(); i++)
+            constEdges.push_back(node->getParentEdgesAtPort(i)[0]);
+        for (auto& edge : constEdges)
+            graph.RemoveEdge(edge);
+        graph.DropNode(node);
+    };
+
+    for (const auto& embedding : graphNodes) {
+        if (!isSuitableEmbeddingNode(embedding))
+            continue;
+
+        std::vector<NodePtr> chain;
+        auto node = embedding->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isSuitableChainNode(node, Type::Eltwise, Algorithm::EltwiseMultiply) || node->getParentEdges().size() != 2)
+            continue;
+        chain.push_back(node);
+        const auto scalesNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        node = node->getParentEdgesAtPort(0)[0]->getParent();
+
+        NodePtr zeroPointsNode;
+        if (node->getType() == Type::Eltwise) {
+            if (!isSuitableChainNode(node, Type::Eltwise, Algorithm::EltwiseSubtract) || node->getParentEdges().size() != 2)
+                continue;
+            chain.push_back(node);
+            zeroPointsNode = node->getParentEdgesAtPort(1)[0]->getParent();
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (!isSuitableChainNode(node, Type::Convert))
+            continue;
+        chain.push_back(node);
+
+        const auto tableNode = node->getParentEdgesAtPort(0)[0]->getParent();
+        const auto tablePrecision = tableNode->getOriginalOutputPrecisionAtPort(0);
+        if (tableNode->getType() != Type::Input || !tableNode->isConstant() ||
+            !one_of(tablePrecision, Precision::U8, Precision::I8))
+            continue;
+
+        const auto& tableDims = tableNode->getOutputShapeAtPort(0).getStaticDims();
+        if (tableDims.empty() || tableDims != embedding->getInputShapeAtPort(0).getStaticDims())
+            continue;
+
+        std::vector<float> scales;
+        if (!readParams(scalesNode, tableDims, scales))
+            continue;
+
+        std::vector<float> zeroPoints;
+        if (zeroPointsNode && !readParams(zeroPointsNode, tableDims, zeroPoints))
+            continue;
+
+        auto embeddingNode = dynamic_cast<node::EmbeddingBagSum*>(embedding.get());
+        if (embeddingNode == nullptr)
+            IE_THROW() << "Cannot cast " << embedding->getName() << " to EmbeddingBagSum node";
+        embeddingNode->setTableDecompression(std::move(scales), std::move(zeroPoints));
+        embedding->setOriginalInputPrecisionAtPort(0, tablePrecision);
+
+        for (const auto& chainNode : chain)
+            dropChainNode(chainNode);
+    }
+}
+
 void GraphOptimizer::FuseFullyConnectedAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1618,6 +1859,50 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseConvertAndEltwise(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // The lowered preprocessing (e.g. U8 image -> Convert -> Subtract(mean) -> Multiply(scale)) is executed as a separate
+    // Convert pass followed by the fused Eltwise chain. The Eltwise jit kernel loads the integer inputs with conversion,
+    // so the Convert is folded into the Eltwise and the image is converted and normalized in a single pass.
+    auto isSuitableConvertNode = [](const NodePtr& node) {
+        return node->getType() == Type::Convert
+                && !node->isConstant()
+                && node->getChildEdges().size() == 1
+                && one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8, Precision::U16, Precision::I16, Precision::I32)
+                && one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    auto isSuitableEltwiseNode = [](const NodePtr& node, size_t port) {
+        if (node->getType() != Type::Eltwise || port >= node->getOriginalInputPrecisions().size())
+            return false;
+
+        // the other input must keep the execution in floating point, otherwise the integer arithmetic is applied
+        // to the not converted values
+        const auto& inputPrecisions = node->getOriginalInputPrecisions();
+        for (size_t i = 0; i < inputPrecisions.size(); i++) {
+            if (i != port && one_of(inputPrecisions[i], Precision::FP32, Precision::BF16))
+                return true;
+        }
+        return false;
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode))
+            continue;
+
+        auto convertNode = graphNode;
+        auto childEdge = convertNode->getChildEdgeAt(0);
+        auto eltwiseNode = childEdge->getChild();
+        const size_t port = childEdge->getOutputNum();
+        if (!isSuitableEltwiseNode(eltwiseNode, port))
+            continue;
+
+        eltwiseNode->setOriginalInputPrecisionAtPort(port, convertNode->getOriginalInputPrecisionAtPort(0));
+        graph.DropNode(convertNode);
+    }
+}
+
 void GraphOptimizer::DropDoubleReorders(Graph &graph) {
     std::set<NodePtr> processed;
     std::size_t graphNodesSize = graph.GetNodes().size();
@@ -20,6 +20,8 @@ public:
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
 
 private:
+    void FuseFCAndWeightsDecompression(Graph &graph);
+    void FuseEmbeddingAndTableDecompression(Graph &graph);
     void FuseConvolutionMatMulAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
@@ -39,6 +41,7 @@ private:
     void FuseConvolutionAndZeroPoints(Graph &graph);
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
+    void FuseConvertAndEltwise(Graph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph);
     void FuseClampAndFakeQuantize(Graph &graph);
     void MergeTransposeAndReorder(Graph &graph);
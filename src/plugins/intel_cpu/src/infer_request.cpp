@@ -93,45 +93,54 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
 }
 
 void InferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+    // the request may be executed by the graphs of different streams, so the bindings are updated on the graph change
+    if (statesGraph != graph) {
+        statesBindings.clear();
+        for (auto &node : graph->GetNodes()) {
+            if (node->getType() == Type::MemoryInput) {
+                auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+                if (!cur_node) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+                }
+                auto cur_id = cur_node->getId();
+                for (const auto& state : memoryStates) {
+                    if (state->GetName() == cur_id) {
+                        statesBindings.emplace_back(cur_node, state);
+                    }
                 }
             }
         }
+        statesGraph = graph;
+    }
+
+    for (const auto& binding : statesBindings) {
+        auto cur_state_mem = binding.first->getStore();
+        auto data_ptr = binding.second->GetState()->cbuffer().as<void*>();
+        auto data_size = binding.second->GetState()->byteSize();
+
+        if (data_size == cur_state_mem->GetSize()) {
+            // the graph reads and updates the state buffer in place, so no copies are needed in both directions
+            binding.first->bindState(data_ptr);
+        } else {
+            auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+            cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+        }
     }
 }
 
 void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+    for (const auto& binding : statesBindings) {
+        auto cur_state_mem = binding.first->getStore();
+        auto data_ptr = binding.second->GetState()->cbuffer().as<void*>();
+        auto data_size = binding.second->GetState()->byteSize();
+
+        if (data_size == cur_state_mem->GetSize()) {
+            // the state buffer is already up to date, it is unbound as the graph is shared with the other requests
+            // and may outlive this one
+            binding.first->unbindState();
+        } else {
+            auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+            cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
         }
     }
 }
@@ -176,7 +185,15 @@ void InferRequestBase::InferImpl() {
         PushStates();
     }
 
-    graph->Infer(this);
+    try {
+        graph->Infer(this);
+    } catch (...) {
+        // the graph must not keep the state buffers of the request
+        if (memoryStates.size() != 0) {
+            PullStates();
+        }
+        throw;
+    }
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -15,6 +15,9 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+namespace node {
+class MemoryInput;
+}   // namespace node
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -67,6 +70,9 @@ private:
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    // the states paired with the MemoryInput nodes of the graph the request was executed by the last time
+    std::vector<std::pair<node::MemoryInput*, std::shared_ptr<InferenceEngine::IVariableStateInternal>>> statesBindings;
+    const Graph*                        statesGraph = nullptr;
     AsyncInferRequest*                  _asyncRequest = nullptr;
 };
 
@@ -3,22 +3,155 @@
 //
 
 #include "convert_matmul_to_fc.hpp"
+#include "mark_weights_decompression.hpp"
 #include "op/fully_connected.hpp"
+#include "utils/general_utils.h"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 
+namespace {
+
+// Weights kept compressed by MarkWeightsDecompression:
+// Constant(u8/i8) -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape]
+struct WeightsDecompression {
+    std::shared_ptr<ngraph::opset1::Constant> weights;
+    std::shared_ptr<ngraph::Node> convert;
+    std::shared_ptr<ngraph::opset1::Constant> zero_point;
+    std::shared_ptr<ngraph::opset1::Constant> scale;
+    // the weights of shape [O, G, K / G] are decompressed per group and reshaped to [O, K]
+    bool grouped = false;
+};
+
+bool matchWeightsDecompression(const ngraph::Output<ngraph::Node>& weights, WeightsDecompression& decompression) {
+    auto node = weights.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node)) {
+        node = node->get_input_node_shared_ptr(0);
+        decompression.grouped = true;
+    }
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node) || !ov::intel_cpu::isWeightsDecompressionEltwise(node))
+        return false;
+    decompression.scale = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+    node = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(node)) {
+        decompression.zero_point = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+        if (!decompression.zero_point)
+            return false;
+        node = node->get_input_node_shared_ptr(0);
+    }
+    decompression.convert = node;
+    decompression.weights = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0));
+    return decompression.scale && decompression.weights;
+}
+
+bool isFusableWeightsDecompression(const WeightsDecompression& decompression, const ngraph::element::Type& activations_type) {
+    return ov::intel_cpu::one_of(activations_type, ngraph::element::f32, ngraph::element::bf16) &&
+           decompression.scale->get_element_type() == ngraph::element::f32 &&
+           (!decompression.zero_point || decompression.zero_point->get_element_type() == ngraph::element::f32);
+}
+
+// Broadcasts the scale (zero point) to the shape [O, 1] or [O, G, 1] of FullyConnected weights,
+// returns nullptr if the parameter varies along the input channels
+std::shared_ptr<ngraph::opset1::Constant> normalizeDecompressionParam(const std::shared_ptr<ngraph::opset1::Constant>& param,
+                                                                      const ngraph::Shape& weights_shape,
+                                                                      bool transposed_weights) {
+    auto shape = param->get_shape();
+    if (shape.size() > weights_shape.size())
+        return nullptr;
+    shape.insert(shape.begin(), weights_shape.size() - shape.size(), 1);
+    // [1, O] and [O, 1] have the same layout, so the parameter of [K, O] weights is just reshaped
+    if (transposed_weights)
+        std::swap(shape[0], shape[1]);
+
+    ngraph::Shape target_shape(weights_shape.begin(), weights_shape.end() - 1);
+    target_shape.push_back(1);
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && shape[i] != target_shape[i])
+            return nullptr;
+    }
+
+    const auto reshaped = std::make_shared<ngraph::opset1::Constant>(*param, shape);
+    if (shape == target_shape)
+        return reshaped;
+    const auto target_shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ target_shape.size() }, target_shape);
+    return ngraph::as_type_ptr<ngraph::opset1::Constant>(
+        ngraph::op::util::make_try_fold<ngraph::opset1::Broadcast>(reshaped, target_shape_const));
+}
+
+// Builds the decompression subgraph in the canonical form FullyConnected is fused with:
+// Constant [O, K] -> Convert -> [Reshape [O, G, K / G]] -> [Subtract] -> Multiply -> [Reshape [O, K]]
+bool normalizeWeightsDecompression(const WeightsDecompression& decompression, bool transpose_b,
+                                   ngraph::Output<ngraph::Node>& fc_weights, ngraph::NodeVector& new_ops) {
+    auto weights_shape = decompression.weights->get_shape();
+    if (decompression.grouped && (!transpose_b || weights_shape.size() != 3))
+        return false;
+    if (!decompression.grouped && weights_shape.size() != 2)
+        return false;
+
+    const bool transposed_weights = !decompression.grouped && !transpose_b;
+    std::shared_ptr<ngraph::opset1::Constant> weights = decompression.weights;
+    if (transposed_weights) {
+        const auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, 0 });
+        weights = ngraph::as_type_ptr<ngraph::opset1::Constant>(ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(weights, order));
+        if (!weights)
+            return false;
+    }
+
+    const auto param_shape = transposed_weights ? weights->get_shape() : weights_shape;
+    const auto scale = normalizeDecompressionParam(decompression.scale, param_shape, transposed_weights);
+    if (!scale)
+        return false;
+    std::shared_ptr<ngraph::opset1::Constant> zero_point;
+    if (decompression.zero_point) {
+        zero_point = normalizeDecompressionParam(decompression.zero_point, param_shape, transposed_weights);
+        if (!zero_point)
+            return false;
+    }
+
+    const ngraph::Shape fc_weights_shape{ weights_shape[0], ngraph::shape_size(weights_shape) / weights_shape[0] };
+    if (decompression.grouped && fc_weights.get_shape() != fc_weights_shape)
+        return false;
+    if (decompression.grouped)
+        weights = std::make_shared<ngraph::opset1::Constant>(*weights, fc_weights_shape);
+
+    auto convert = decompression.convert->clone_with_new_inputs({ weights });
+    ov::disable_constant_folding(convert);
+    new_ops.push_back(convert);
+    ngraph::Output<ngraph::Node> decompressed = convert;
+    if (decompression.grouped) {
+        const auto grouped_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, weights_shape);
+        decompressed = std::make_shared<ngraph::opset1::Reshape>(decompressed, grouped_shape, false);
+        new_ops.push_back(decompressed.get_node_shared_ptr());
+    }
+    if (zero_point) {
+        decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, zero_point);
+        new_ops.push_back(decompressed.get_node_shared_ptr());
+    }
+    decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, scale);
+    new_ops.push_back(decompressed.get_node_shared_ptr());
+    if (decompression.grouped) {
+        const auto fc_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, fc_weights_shape);
+        decompressed = std::make_shared<ngraph::opset1::Reshape>(decompressed, fc_shape, false);
+        new_ops.push_back(decompressed.get_node_shared_ptr());
+    }
+    fc_weights = decompressed;
+    return true;
+}
+
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
         const auto& pattern_map = m.get_pattern_value_map();
 
         auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
-        if (!matmul || transformation_callback(matmul)) {
+        if (!matmul) {
             return false;
         }
 
@@ -27,6 +160,19 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
 
+        WeightsDecompression decompression;
+        const bool is_decompression = matchWeightsDecompression(fc_input_b, decompression);
+        // the weights decompression subgraph marked by MarkWeightsDecompression is kept unfolded only
+        // if it is fused into FullyConnected, so the folding is enabled back on every rejection
+        auto reject = [&]() {
+            if (is_decompression)
+                ov::enable_constant_folding(decompression.convert);
+            return false;
+        };
+        if (transformation_callback(matmul)) {
+            return reject();
+        }
+
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
         NGRAPH_CHECK(shape_b.is_static());
@@ -37,14 +183,18 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Transformation to FC is not supported for 1D inputs
         if (rank_a == 1 || rank_b == 1 ||
             rank_a > 3 || rank_b > 3) {
-            return false;
+            return reject();
         }
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!is_decompression && !std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr())) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
-            return false;
+            return reject();
+        }
+        // FullyConnected decompresses only 2D weights for f32 (bf16) activations with f32 scale and zero point
+        if (is_decompression && (rank_b != 2 || !isFusableWeightsDecompression(decompression, fc_input_a.get_element_type()))) {
+            return reject();
         }
         /*
          *  get_aligned_shapes function align two input shapes to have the same size and
@@ -120,7 +270,7 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         ngraph::PartialShape shape_a_aligned, shape_b_aligned;
         std::tie(success, shape_a_aligned, shape_b_aligned) = get_aligned_shapes();
         if (!success) {
-            return false;
+            return reject();
         }
 
         auto aligned_a_rank = shape_a_aligned.rank(), aligned_b_rank = shape_b_aligned.rank();
@@ -132,7 +282,11 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
         // Weights normalization
-        if (!matmul->get_transpose_b()) {
+        if (is_decompression) {
+            if (!normalizeWeightsDecompression(decompression, matmul->get_transpose_b(), fc_input_b, new_ops)) {
+                return reject();
+            }
+        } else if (!matmul->get_transpose_b()) {
             fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
             new_ops.push_back(fc_input_b.get_node_shared_ptr());
         }
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+
+#include <algorithm>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "utils/general_utils.h"
+
+namespace {
+
+bool isConstantPath(const std::shared_ptr<ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        return ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0));
+    return ngraph::is_type<ngraph::opset1::Constant>(node);
+}
+
+bool isDecompressionParam(const ngraph::Output<ngraph::Node>& param) {
+    return isConstantPath(param.get_node_shared_ptr()) && param.get_element_type() == ngraph::element::f32;
+}
+
+// the scale (zero point) of the whole table or of the table row
+bool isTableDecompressionParam(const ngraph::Output<ngraph::Node>& param, const ngraph::PartialShape& tableShape) {
+    if (!isDecompressionParam(param) || param.get_partial_shape().is_dynamic())
+        return false;
+    const auto& shape = param.get_shape();
+    if (ngraph::shape_size(shape) == 1)
+        return true;
+    if (tableShape.rank().is_dynamic() || shape.size() != static_cast<size_t>(tableShape.rank().get_length()))
+        return false;
+    if (tableShape[0].is_dynamic() || shape[0] != static_cast<size_t>(tableShape[0].get_length()))
+        return false;
+    return std::all_of(shape.begin() + 1, shape.end(), [](size_t dim) { return dim == 1; });
+}
+
+}   // namespace
+
+ov::intel_cpu::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4}));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ weights_m }, ngraph::pattern::consumers_count(1));
+    auto zero_point_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Convert>();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_point_m }, ngraph::pattern::consumers_count(1));
+    auto scale_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ convert_m, subtract_m });
+    auto scale_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Convert>();
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ scale_input_m, scale_m }, ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({ multiply_m, ngraph::pattern::wrap_type<ngraph::opset1::Constant>() },
+                                                                         ngraph::pattern::consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ multiply_m, reshape_m });
+    auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, matmul_weights_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        if (!convert->get_output_element_type(0).is_real() || ov::constant_folding_is_disabled(convert))
+            return false;
+        // the marked subgraph must be fused into FullyConnected by the plugin, otherwise the weights stay unfolded,
+        // so only the cases FullyConnected supports are marked: f32 (bf16) activations of rank 2 or 3 and f32 parameters
+        const auto& activations = pattern_map.at(activations_m);
+        const auto activations_rank = activations.get_partial_shape().rank().get_length();
+        if (activations_rank != 2 && activations_rank != 3)
+            return false;
+        if (!ov::intel_cpu::one_of(activations.get_element_type(), ngraph::element::f32, ngraph::element::bf16))
+            return false;
+        if (!isDecompressionParam(pattern_map.at(scale_m)))
+            return false;
+        if (pattern_map.count(subtract_m) && !isDecompressionParam(pattern_map.at(zero_point_m)))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+ov::intel_cpu::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    auto table_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ngraph::element::u8, ngraph::element::i8}));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ table_m }, ngraph::pattern::consumers_count(1));
+    auto zero_point_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Convert>();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_point_m }, ngraph::pattern::consumers_count(1));
+    auto scale_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ convert_m, subtract_m });
+    auto scale_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Convert>();
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ scale_input_m, scale_m }, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        // the embedding nodes have a variable number of inputs, so the consumer is checked here
+        const auto consumer = *pattern_map.at(multiply_m).get_target_inputs().begin();
+        const auto embedding = consumer.get_node();
+        if (consumer.get_index() != 0 ||
+            (!ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(embedding) &&
+             !ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(embedding) &&
+             !ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(embedding)))
+            return false;
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        if (convert->get_output_element_type(0) != ngraph::element::f32 || ov::constant_folding_is_disabled(convert))
+            return false;
+        // the marked subgraph must be fused into the embedding node by the plugin, otherwise the table stays unfolded
+        const auto& tableShape = pattern_map.at(table_m).get_partial_shape();
+        if (!isTableDecompressionParam(pattern_map.at(scale_m), tableShape))
+            return false;
+        if (pattern_map.count(subtract_m) && !isTableDecompressionParam(pattern_map.at(zero_point_m), tableShape))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply_m, "MarkEmbeddingTableDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::isWeightsDecompressionConvert(const std::shared_ptr<const ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Convert>(node) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0)) &&
+           node->get_input_element_type(0).is_integral() &&
+           ov::constant_folding_is_disabled(std::const_pointer_cast<ngraph::Node>(node));
+}
+
+bool ov::intel_cpu::isWeightsDecompressionEltwise(const std::shared_ptr<const ngraph::Node>& node) {
+    if (!ngraph::is_type<ngraph::opset1::Subtract>(node) && !ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+    auto parent = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Multiply>(node) && ngraph::is_type<ngraph::opset1::Subtract>(parent))
+        parent = parent->get_input_node_shared_ptr(0);
+    return isWeightsDecompressionConvert(parent);
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     MarkWeightsDecompression keeps the int8 (int4) weights of MatMul compressed: constant folding is disabled
+ *     for the Convert of the weights decompression subgraph, so the weights are not folded to f32 and the plugin
+ *     fuses the subgraph into FullyConnected which decompresses the weights on the fly.
+ *     Only the subgraphs FullyConnected can be fused with are marked (f32 scale and zero point, f32 / bf16 activations
+ *     of rank 2 or 3); ConvertMatMulToFC enables the folding back if it rejects the marked subgraph.
+ *
+ * Subgraph:
+ *
+ *     Constant(u8/i8/u4/i4)
+ *            |
+ *         Convert     Constant
+ *            |       /
+ *        [Subtract]     Constant
+ *            |         /
+ *         Multiply
+ *            |
+ *        [Reshape]
+ *            |
+ *          MatMul
+ */
+
+class MarkWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkWeightsDecompression", "0");
+    MarkWeightsDecompression();
+};
+
+/*
+ * Description:
+ *     MarkEmbeddingTableDecompression keeps the int8 embedding tables compressed the same way: the marked subgraph is
+ *     fused into the embedding node which dequantizes the rows while they are accumulated.
+ *     Only the f32 scale and zero point per table row ([N, 1, ..., 1]) or per tensor are supported.
+ *
+ * Subgraph:
+ *
+ *     Constant(u8/i8)
+ *            |
+ *         Convert     Constant
+ *            |       /
+ *        [Subtract]     Constant
+ *            |         /
+ *         Multiply
+ *            |
+ *     EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+ */
+
+class MarkEmbeddingTableDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkEmbeddingTableDecompression", "0");
+    MarkEmbeddingTableDecompression();
+};
+
+/**
+ * @brief Checks whether the node is the Convert of the weights decompression subgraph marked by MarkWeightsDecompression
+ */
+bool isWeightsDecompressionConvert(const std::shared_ptr<const ngraph::Node>& node);
+
+/**
+ * @brief Checks whether the node is Subtract (zero point) or Multiply (scale) of the weights decompression subgraph
+ */
+bool isWeightsDecompressionEltwise(const std::shared_ptr<const ngraph::Node>& node);
+
+}   // namespace intel_cpu
+}   // namespace ov
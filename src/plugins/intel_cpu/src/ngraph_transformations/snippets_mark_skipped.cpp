@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "snippets_mark_skipped.hpp"
+#include "mark_weights_decompression.hpp"
 #include <snippets/pass/collapse_subgraph.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/general_utils.h>
@@ -300,6 +301,11 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
     for (auto &node : m->get_ordered_ops()) {
         if (ngraph::op::is_constant(node))
             continue;
+        if (isWeightsDecompressionEltwise(node)) {
+            // The weights decompression is fused into FullyConnected (the embedding node)
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            continue;
+        }
         if (ngraph::op::is_parameter(node)) {
             SetNodeFusingType(node, NodeFusingType::IgnoredAfterInputs);
             continue;
@@ -61,6 +61,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace mkldnn;
 using namespace openvino;
@@ -71,6 +72,35 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+struct ShapeInferKey {
+    // the key keeps the shape inference alive, so its address can't be reused by another one while the key is cached
+    std::shared_ptr<IShapeInfer> shapeInference;
+    std::vector<VectorDims> inputShapes;
+    // the data of the inputs the shape inference depends on
+    std::vector<uint8_t> inputValues;
+
+    size_t hash() const;
+    bool operator==(const ShapeInferKey& rhs) const;
+};
+
+size_t ShapeInferKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = hash_combine(0, shapeInference.get());
+    for (const auto& dims : inputShapes) {
+        seed = get_vector_hash(seed, dims);
+    }
+    seed = get_vector_hash(seed, inputValues);
+    return seed;
+}
+
+bool ShapeInferKey::operator==(const ShapeInferKey& rhs) const {
+    return shapeInference == rhs.shapeInference && inputShapes == rhs.inputShapes && inputValues == rhs.inputValues;
+}
+} // namespace
+
 Node::NodesFactory & Node::factory() {
     static NodesFactory factoryInstance;
     return factoryInstance;
@@ -1464,6 +1494,47 @@ std::vector<VectorDims> Node::shapeInfer() const {
 
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                                 uint32_t input_value_port_mask) const {
+    if (!rtParamsCache) {
+        return shapeInferGenericImpl(input_shapes, input_value_port_mask);
+    }
+
+    // the values of the large inputs (e.g. the Gather indices) usually change on every inference, so copying and
+    // hashing them would only add the overhead and fill the cache with the keys which are never hit
+    constexpr size_t maxMemoizedValuesSize = 256;  // bytes
+    size_t valuesSize = 0;
+    for (size_t port = 0; port < input_shapes.size(); port++) {
+        if (input_value_port_mask & (1 << port)) {
+            valuesSize += getParentEdgesAtPort(port)[0]->getMemory().GetSize();
+        }
+    }
+    if (valuesSize > maxMemoizedValuesSize) {
+        return shapeInferGenericImpl(input_shapes, input_value_port_mask);
+    }
+
+    // the dynamic models often alternate between a limited set of shapes, so the results are memoized in the runtime
+    // cache of the graph
+    ShapeInferKey key{shapeInference, {}, {}};
+    key.inputShapes.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.inputShapes.emplace_back(shape.to_shape());
+    }
+    key.inputValues.reserve(valuesSize);
+    for (size_t port = 0; port < input_shapes.size(); port++) {
+        if (input_value_port_mask & (1 << port)) {
+            const auto& mem = getParentEdgesAtPort(port)[0]->getMemory();
+            const auto data = static_cast<const uint8_t*>(mem.GetPtr());
+            key.inputValues.insert(key.inputValues.end(), data, data + mem.GetSize());
+        }
+    }
+
+    auto builder = [&](const ShapeInferKey&) {
+        return shapeInferGenericImpl(input_shapes, input_value_port_mask);
+    };
+    return rtParamsCache->getOrCreate(key, builder).first;
+}
+
+std::vector<VectorDims> Node::shapeInferGenericImpl(const std::vector<StaticShape>& input_shapes,
+                                                    uint32_t input_value_port_mask) const {
     // collect input values
     std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
     if (input_value_port_mask) {
@@ -718,6 +718,10 @@ protected:
     bool outputShapesDefined() const;
     bool shapesDefined() const;
     void updateLastInputDims();
+    // forces the shape inference and prepareParams on the next dynamic execution
+    void resetLastInputDims() {
+        lastInputDims.clear();
+    }
 
     bool inputShapesModified() const;
     virtual bool needShapeInfer() const;
@@ -789,6 +793,8 @@ private:
 
     std::vector<VectorDims> shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                               uint32_t input_value_port_mask) const;
+    std::vector<VectorDims> shapeInferGenericImpl(const std::vector<StaticShape>& input_shapes,
+                                                  uint32_t input_value_port_mask) const;
 
 #ifdef CPU_DEBUG_CAPS
     friend class Verbose;
@@ -0,0 +1,378 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_decompression.h"
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_args, field)
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_fc_decompression_args {
+    const void* weights;
+    const float* scale;
+    float* dst;
+    size_t work_amount;
+};
+
+struct jit_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_args *);
+
+    void operator()(const jit_fc_decompression_args *args) const { assert(ker_); ker_(args); }
+
+    explicit jit_fc_decompression_kernel(Precision prc) : ker_(nullptr), prc(prc) {}
+    virtual ~jit_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    const Precision prc;
+};
+
+// converts work_amount weights sharing the same scale to f32 and multiplies them by the scale,
+// work_amount is a multiple of the vector length
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel : public jit_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel)
+
+    explicit jit_uni_fc_decompression_kernel(Precision prc) : jit_fc_decompression_kernel(prc), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const bool is4bit = one_of(prc, Precision::U4, Precision::I4);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        Xbyak::Label shifts_label;
+
+        this->preamble();
+
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_scale, ptr[reg_params + GET_OFF(scale)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vbroadcastss(vmm_scale, ptr[reg_scale]);
+        if (is4bit) {
+            mov(reg_shifts, shifts_label);
+            uni_vmovups(vmm_shifts, ptr[reg_shifts]);
+        }
+
+        L(loop_label); {
+            cmp(reg_work_amount, step);
+            jl(loop_end_label, T_NEAR);
+
+            load_weights(vmm_val);
+            uni_vcvtdq2ps(vmm_val, vmm_val);
+            uni_vmulps(vmm_val, vmm_val, vmm_scale);
+            uni_vmovups(ptr[reg_dst], vmm_val);
+
+            add(reg_weights, is4bit ? step / 2 : step);
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(loop_end_label);
+
+        this->postamble();
+
+        if (is4bit) {
+            align(64);
+            L(shifts_label);
+            // moves the low nibble of the even element and the high nibble of the odd element to the top bits
+            for (size_t i = 0; i < step; i++)
+                dd(i % 2 ? 24 : 28);
+        }
+    }
+
+private:
+    using Vmm = typename conditional<isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_weights = r8;
+    Xbyak::Reg64 reg_scale = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_shifts = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_shifts = Vmm(2);
+
+    inline void load_weights(Vmm vmm) {
+        Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+
+        switch (prc) {
+            case Precision::U8:
+                vpmovzxbd(vmm, ptr[reg_weights]);
+                break;
+            case Precision::I8:
+                vpmovsxbd(vmm, ptr[reg_weights]);
+                break;
+            case Precision::U4:
+            case Precision::I4:
+                // step / 2 bytes, every byte is duplicated so each nibble gets its own dword
+                if (isa == x64::avx2)
+                    vmovd(xmm, ptr[reg_weights]);
+                else
+                    vmovq(xmm, ptr[reg_weights]);
+                vpunpcklbw(xmm, xmm, xmm);
+                vpmovzxbd(vmm, xmm);
+                // the nibble is shifted to the top bits and back, the arithmetic shift extends the sign of I4
+                vpsllvd(vmm, vmm, vmm_shifts);
+                if (prc == Precision::I4)
+                    vpsrad(vmm, vmm, 28);
+                else
+                    vpsrld(vmm, vmm, 28);
+                break;
+            default:
+                assert(!"unsupported weights precision");
+        }
+    }
+};
+
+namespace {
+
+// output channels of the tile of the decompressed weights
+constexpr size_t ocBlock = 16;
+// input channels of the tile, the tile of 16 KB stays in L1
+constexpr size_t icBlock = 256;
+// rows of the activations multiplied by the same tile
+constexpr size_t mBlock = 16;
+// independent partial sums of the dot product, they are mapped to the vector registers by the compiler
+constexpr size_t lanes = 16;
+
+inline float dot(const float* a, const float* b, size_t n) {
+    float acc[lanes] = {};
+    size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        for (size_t l = 0; l < lanes; l++)
+            acc[l] += a[i + l] * b[i + l];
+    }
+    float sum = 0.f;
+    for (; i < n; i++)
+        sum += a[i] * b[i];
+    for (size_t l = 0; l < lanes; l++)
+        sum += acc[l];
+    return sum;
+}
+
+// the reference conversion of the weights [i0, i1) of the row, used for the tails and on the targets without AVX2
+void decompressRef(Precision prc, const uint8_t* row, size_t i0, size_t i1, float scale, float* dst) {
+    switch (prc) {
+        case Precision::U8:
+            for (size_t i = i0; i < i1; i++)
+                dst[i - i0] = static_cast<float>(row[i]) * scale;
+            break;
+        case Precision::I8:
+            for (size_t i = i0; i < i1; i++)
+                dst[i - i0] = static_cast<float>(static_cast<int8_t>(row[i])) * scale;
+            break;
+        case Precision::U4:
+            for (size_t i = i0; i < i1; i++)
+                dst[i - i0] = static_cast<float>((row[i / 2] >> (i % 2 * 4)) & 0xF) * scale;
+            break;
+        case Precision::I4:
+            for (size_t i = i0; i < i1; i++)
+                dst[i - i0] = static_cast<float>((((row[i / 2] >> (i % 2 * 4)) & 0xF) ^ 8) - 8) * scale;
+            break;
+        default:
+            IE_THROW() << "Unsupported precision of the compressed weights: " << prc;
+    }
+}
+
+// the activations are multiplied in f32, the bf16 ones are converted row by row within the tile
+inline const float* toFloat(const float* src, size_t, float*) {
+    return src;
+}
+
+inline const float* toFloat(const bfloat16_t* src, size_t n, float* buffer) {
+    for (size_t i = 0; i < n; i++)
+        buffer[i] = static_cast<float>(src[i]);
+    return buffer;
+}
+
+}   // namespace
+
+FCWeightsDecompression::FCWeightsDecompression(Precision weightsPrc, Precision srcPrc, Precision dstPrc)
+    : weightsPrc(weightsPrc), srcPrc(srcPrc), dstPrc(dstPrc) {
+    if (!one_of(weightsPrc, Precision::U8, Precision::I8, Precision::U4, Precision::I4))
+        IE_THROW() << "Unsupported precision of the compressed weights: " << weightsPrc;
+    if (!one_of(srcPrc, Precision::FP32, Precision::BF16) || !one_of(dstPrc, Precision::FP32, Precision::BF16))
+        IE_THROW() << "Unsupported activations precision of the compressed weights inner product: "
+                   << srcPrc << " -> " << dstPrc;
+
+    if (mayiuse(x64::avx512_core)) {
+        kernel.reset(new jit_uni_fc_decompression_kernel<x64::avx512_core>(weightsPrc));
+        kernelStep = 16;
+    } else if (mayiuse(x64::avx2)) {
+        kernel.reset(new jit_uni_fc_decompression_kernel<x64::avx2>(weightsPrc));
+        kernelStep = 8;
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+impl_desc_type FCWeightsDecompression::getImplType() {
+    if (mayiuse(x64::avx512_core))
+        return impl_desc_type::jit_avx512;
+    if (mayiuse(x64::avx2))
+        return impl_desc_type::jit_avx2;
+    return impl_desc_type::ref_any;
+}
+
+bool FCWeightsDecompression::fitsInt4(Precision precision, const void* weights, size_t size) {
+    if (precision == Precision::U8) {
+        const auto* data = static_cast<const uint8_t*>(weights);
+        return std::all_of(data, data + size, [](uint8_t value) { return value < 16; });
+    }
+    if (precision == Precision::I8) {
+        const auto* data = static_cast<const int8_t*>(weights);
+        return std::all_of(data, data + size, [](int8_t value) { return value >= -8 && value < 8; });
+    }
+    return false;
+}
+
+void FCWeightsDecompression::packToInt4(const void* weights, uint8_t* packed, size_t OC, size_t IC) {
+    const auto* data = static_cast<const uint8_t*>(weights);
+    const size_t rowSize = div_up(IC, 2);
+    parallel_for(OC, [&](size_t oc) {
+        const uint8_t* src = data + oc * IC;
+        uint8_t* dst = packed + oc * rowSize;
+        for (size_t i = 0; i < rowSize; i++) {
+            const uint8_t low = src[2 * i] & 0xF;
+            const uint8_t high = 2 * i + 1 < IC ? src[2 * i + 1] & 0xF : 0;
+            dst[i] = static_cast<uint8_t>(low | (high << 4));
+        }
+    });
+}
+
+void FCWeightsDecompression::decompressRow(const FCCompressedWeights& p, size_t oc, size_t ic0, size_t ic1,
+                                           float* tile) const {
+    const bool is4bit = one_of(weightsPrc, Precision::U4, Precision::I4);
+    const size_t rowSize = is4bit ? div_up(p.IC, 2) : p.IC;
+    const auto* row = static_cast<const uint8_t*>(p.weights) + oc * rowSize;
+    const float* scales = p.scales + oc * (p.IC / p.groupSize);
+
+    for (size_t ic = ic0; ic < ic1;) {
+        const size_t g = ic / p.groupSize;
+        const size_t icEnd = std::min(ic1, (g + 1) * p.groupSize);
+        size_t i = ic;
+        // the kernel starts at a byte boundary of the packed weights
+        if (is4bit && i % 2) {
+            decompressRef(weightsPrc, row, i, i + 1, scales[g], tile + (i - ic0));
+            i++;
+        }
+        const size_t kernelWork = kernel ? (icEnd - i) / kernelStep * kernelStep : 0;
+        if (kernelWork) {
+            auto args = jit_fc_decompression_args();
+            args.weights = row + (is4bit ? i / 2 : i);
+            args.scale = scales + g;
+            args.dst = tile + (i - ic0);
+            args.work_amount = kernelWork;
+            (*kernel)(&args);
+            i += kernelWork;
+        }
+        if (i < icEnd)
+            decompressRef(weightsPrc, row, i, icEnd, scales[g], tile + (i - ic0));
+        ic = icEnd;
+    }
+}
+
+template <typename src_t, typename dst_t>
+void FCWeightsDecompression::exec(const FCCompressedWeights& p, const src_t* src, dst_t* dst, size_t M) const {
+    const size_t groups = p.IC / p.groupSize;
+
+    // sum(x[ic] * (w[ic] - zp) * s) = sum(x[ic] * w[ic] * s) - zp * s * sum(x[ic]) over the group
+    std::vector<float> srcSums;
+    if (p.zeroPoints) {
+        srcSums.resize(M * groups);
+        parallel_for2d(M, groups, [&](size_t m, size_t g) {
+            const src_t* x = src + m * p.IC + g * p.groupSize;
+            float sum = 0.f;
+            for (size_t i = 0; i < p.groupSize; i++)
+                sum += static_cast<float>(x[i]);
+            srcSums[m * groups + g] = sum;
+        });
+    }
+
+    parallel_for2d(div_up(M, mBlock), div_up(p.OC, ocBlock), [&](size_t mb, size_t ob) {
+        const size_t m0 = mb * mBlock;
+        const size_t m1 = std::min(M, m0 + mBlock);
+        const size_t oc0 = ob * ocBlock;
+        const size_t oc1 = std::min(p.OC, oc0 + ocBlock);
+
+        float tile[ocBlock * icBlock];
+        float srcTile[mBlock * icBlock];
+        float acc[mBlock * ocBlock] = {};
+        for (size_t ic0 = 0; ic0 < p.IC; ic0 += icBlock) {
+            const size_t ic1 = std::min(p.IC, ic0 + icBlock);
+            for (size_t oc = oc0; oc < oc1; oc++)
+                decompressRow(p, oc, ic0, ic1, tile + (oc - oc0) * icBlock);
+            for (size_t m = m0; m < m1; m++) {
+                const float* x = toFloat(src + m * p.IC + ic0, ic1 - ic0, srcTile + (m - m0) * icBlock);
+                for (size_t oc = oc0; oc < oc1; oc++)
+                    acc[(m - m0) * ocBlock + (oc - oc0)] += dot(x, tile + (oc - oc0) * icBlock, ic1 - ic0);
+            }
+        }
+
+        for (size_t m = m0; m < m1; m++) {
+            for (size_t oc = oc0; oc < oc1; oc++) {
+                float result = acc[(m - m0) * ocBlock + (oc - oc0)];
+                if (p.zeroPoints) {
+                    const float* scales = p.scales + oc * groups;
+                    const float* zeroPoints = p.zeroPoints + oc * groups;
+                    const float* sums = srcSums.data() + m * groups;
+                    for (size_t g = 0; g < groups; g++)
+                        result -= zeroPoints[g] * scales[g] * sums[g];
+                }
+                if (p.bias)
+                    result += p.bias[oc];
+                dst[m * p.OC + oc] = static_cast<dst_t>(result);
+            }
+        }
+    });
+}
+
+void FCWeightsDecompression::execute(const FCCompressedWeights& weights, const void* src, void* dst, size_t M) const {
+    if (weights.precision != weightsPrc)
+        IE_THROW() << "Unexpected precision of the compressed weights: " << weights.precision;
+
+    if (srcPrc == Precision::FP32) {
+        auto floatSrc = static_cast<const float*>(src);
+        if (dstPrc == Precision::FP32)
+            exec(weights, floatSrc, static_cast<float*>(dst), M);
+        else
+            exec(weights, floatSrc, static_cast<bfloat16_t*>(dst), M);
+    } else {
+        auto bf16Src = static_cast<const bfloat16_t*>(src);
+        if (dstPrc == Precision::FP32)
+            exec(weights, bf16Src, static_cast<float*>(dst), M);
+        else
+            exec(weights, bf16Src, static_cast<bfloat16_t*>(dst), M);
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
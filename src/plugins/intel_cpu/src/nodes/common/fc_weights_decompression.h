@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+#include "mkldnn/iml_type_mapper.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Compressed weights of the inner product, the weights of the output channel oc are decompressed as
+ * (weights[oc][ic] - zeroPoints[oc][g]) * scales[oc][g], where g = ic / groupSize
+ */
+struct FCCompressedWeights {
+    size_t OC = 0;
+    size_t IC = 0;
+    // number of the input channels sharing the same scale and zero point, IC in the per-channel case
+    size_t groupSize = 0;
+    // U8, I8 or U4, I4 packed two values per byte: the even input channel is in the low nibble
+    InferenceEngine::Precision precision;
+    // [OC, IC] for 8 bits, [OC, div_up(IC, 2)] bytes for 4 bits
+    const void* weights = nullptr;
+    // [OC, IC / groupSize]
+    const float* scales = nullptr;
+    // [OC, IC / groupSize], nullptr for the symmetric quantization
+    const float* zeroPoints = nullptr;
+    // [OC], may be nullptr
+    const float* bias = nullptr;
+};
+
+struct jit_fc_decompression_kernel;
+
+/**
+ * @brief Computes dst[M, OC] = src[M, IC] * decompressed(weights)^T + bias.
+ * The weights are never decompressed in memory: a tile of the weights is converted to f32 by the JIT kernel right
+ * before it is multiplied by the activations and it stays in L1. The multiplication itself is plain C++ code
+ * vectorized by the compiler. The scales are folded into the decompressed tile, and
+ * the zero points are subtracted from the result using the per group sums of the activations, so the decompression
+ * costs one conversion and one multiplication per weight.
+ */
+class FCWeightsDecompression {
+public:
+    /**
+     * @param weightsPrc precision of the compressed weights
+     * @param srcPrc FP32 or BF16 activations
+     * @param dstPrc FP32 or BF16 output
+     */
+    FCWeightsDecompression(InferenceEngine::Precision weightsPrc,
+                           InferenceEngine::Precision srcPrc,
+                           InferenceEngine::Precision dstPrc);
+
+    /**
+     * @param M number of the rows of the activations
+     */
+    void execute(const FCCompressedWeights& weights, const void* src, void* dst, size_t M) const;
+
+    // the implementation type selected on the current target
+    static impl_desc_type getImplType();
+
+    /**
+     * @brief Checks whether all the 8-bit weights fit into 4 bits (the int4 weights widened to 8 bits by the
+     * transformations always do), then they can be packed by packToInt4 without any loss
+     */
+    static bool fitsInt4(InferenceEngine::Precision precision, const void* weights, size_t size);
+    // packs [OC, IC] 8-bit weights into [OC, div_up(IC, 2)] bytes
+    static void packToInt4(const void* weights, uint8_t* packed, size_t OC, size_t IC);
+
+private:
+    template <typename src_t, typename dst_t>
+    void exec(const FCCompressedWeights& weights, const src_t* src, dst_t* dst, size_t M) const;
+    // tile[ic - ic0] = weights[oc][ic] * scales[oc][ic / groupSize]
+    void decompressRow(const FCCompressedWeights& weights, size_t oc, size_t ic0, size_t ic1, float* tile) const;
+
+    InferenceEngine::Precision weightsPrc;
+    InferenceEngine::Precision srcPrc;
+    InferenceEngine::Precision dstPrc;
+    std::shared_ptr<jit_fc_decompression_kernel> kernel;
+    // number of the weights converted by one iteration of the kernel
+    size_t kernelStep = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
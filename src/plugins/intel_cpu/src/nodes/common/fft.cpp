@@ -0,0 +1,452 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+
+#include <ie_parallel.hpp>
+#include "cpu_memcpy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+struct Complex {
+    float re;
+    float im;
+};
+
+inline Complex operator+(Complex a, Complex b) {
+    return {a.re + b.re, a.im + b.im};
+}
+
+inline Complex operator-(Complex a, Complex b) {
+    return {a.re - b.re, a.im - b.im};
+}
+
+inline Complex operator*(Complex a, float b) {
+    return {a.re * b, a.im * b};
+}
+
+inline Complex mul(Complex a, Complex b) {
+    return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+}
+
+// a * (-i)
+inline Complex mulByMinusI(Complex a) {
+    return {a.im, -a.re};
+}
+
+inline Complex conj(Complex a) {
+    return {a.re, -a.im};
+}
+
+inline Complex polar(double angle) {
+    return {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+}
+
+bool isSmooth(size_t n) {
+    for (size_t radix : {2, 3, 5}) {
+        while (n % radix == 0)
+            n /= radix;
+    }
+    return n == 1;
+}
+
+/*
+ * One stage of the Stockham autosort FFT: the sequences of the length radix * m with the stride s are split into
+ * radix sequences of the length m with the stride radix * s.
+ *     y[q + s * (radix * p + r)] = w^(r * p) * sum(x[q + s * (p + t * m)] * exp(-2 * pi * i * r * t / radix))
+ * The inner loop goes over the contiguous q, so the butterflies of the last stages are vectorized by the compiler.
+ */
+template <size_t radix, typename Butterfly>
+inline void stockhamStage(const Complex* x, Complex* y, size_t m, size_t s, const Complex* w, Butterfly butterfly) {
+    for (size_t p = 0; p < m; p++) {
+        Complex tw[radix];
+        tw[0] = {1.f, 0.f};
+        for (size_t r = 1; r < radix; r++)
+            tw[r] = w[(r - 1) * m + p];
+
+        const Complex* src = x + s * p;
+        Complex* dst = y + s * radix * p;
+        for (size_t q = 0; q < s; q++) {
+            Complex a[radix];
+            for (size_t t = 0; t < radix; t++)
+                a[t] = src[q + s * t * m];
+            butterfly(a);
+            dst[q] = a[0];
+            for (size_t r = 1; r < radix; r++)
+                dst[q + s * r] = mul(a[r], tw[r]);
+        }
+    }
+}
+
+inline void butterfly2(Complex* a) {
+    const Complex t = a[1];
+    a[1] = a[0] - t;
+    a[0] = a[0] + t;
+}
+
+inline void butterfly3(Complex* a) {
+    const float sin60 = 0.866025403784438646764f;
+    const Complex t = a[1] + a[2];
+    const Complex m1 = a[0] - t * 0.5f;
+    const Complex m2 = mulByMinusI(a[1] - a[2]) * sin60;
+    a[0] = a[0] + t;
+    a[1] = m1 + m2;
+    a[2] = m1 - m2;
+}
+
+inline void butterfly4(Complex* a) {
+    const Complex t0 = a[0] + a[2];
+    const Complex t1 = a[0] - a[2];
+    const Complex t2 = a[1] + a[3];
+    const Complex t3 = mulByMinusI(a[1] - a[3]);
+    a[0] = t0 + t2;
+    a[1] = t1 + t3;
+    a[2] = t0 - t2;
+    a[3] = t1 - t3;
+}
+
+inline void butterfly5(Complex* a) {
+    const float cos72 = 0.309016994374947424102f;
+    const float cos144 = -0.809016994374947424102f;
+    const float sin72 = 0.951056516295153572116f;
+    const float sin144 = 0.587785252292473129169f;
+    const Complex t1 = a[1] + a[4];
+    const Complex t2 = a[2] + a[3];
+    const Complex t3 = a[1] - a[4];
+    const Complex t4 = a[2] - a[3];
+    const Complex m1 = a[0] + t1 * cos72 + t2 * cos144;
+    const Complex m2 = a[0] + t1 * cos144 + t2 * cos72;
+    const Complex n1 = mulByMinusI(t3 * sin72 + t4 * sin144);
+    const Complex n2 = mulByMinusI(t3 * sin144 - t4 * sin72);
+    a[0] = a[0] + t1 + t2;
+    a[1] = m1 + n1;
+    a[2] = m2 + n2;
+    a[3] = m2 - n2;
+    a[4] = m1 - n1;
+}
+
+inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
+    auto itCounter = counters.rbegin();
+    auto itWork = iterationRange.rbegin();
+
+    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
+        *itCounter = (*itCounter + 1) % *itWork;
+        if (*itCounter != 0) {
+            return true;
+        }
+        ++itCounter;
+        ++itWork;
+    }
+    return false;
+}
+
+size_t calculateOffsetFromStrides(const std::vector<size_t>& coords, const std::vector<size_t>& strides) {
+    size_t offset = 0;
+    for (size_t index = 0; index < coords.size(); ++index) {
+        offset += coords[index] * strides[index];
+    }
+    return offset;
+}
+
+}   // namespace
+
+FFTPlan::FFTPlan(size_t length) : n(length) {
+    size_t rest = n;
+    std::vector<size_t> radices;
+    while (rest > 1 && rest % 4 == 0) {
+        radices.push_back(4);
+        rest /= 4;
+    }
+    for (size_t radix : {2, 3, 5}) {
+        while (rest > 1 && rest % radix == 0) {
+            radices.push_back(radix);
+            rest /= radix;
+        }
+    }
+
+    if (rest > 1) {
+        // n = 7, 11, 13...: the DFT is computed as the convolution with the chirp of a smooth length
+        size_t convolutionLength = 2 * n - 1;
+        while (!isSmooth(convolutionLength))
+            convolutionLength++;
+        convolution.reset(new FFTPlan(convolutionLength));
+
+        chirp.resize(2 * n);
+        for (size_t k = 0; k < n; k++) {
+            // k^2 mod 2n keeps the angle precise for the big k
+            const size_t k2 = (k * k) % (2 * n);
+            const Complex c = conj(polar(PI * static_cast<double>(k2) / static_cast<double>(n)));
+            chirp[2 * k] = c.re;
+            chirp[2 * k + 1] = c.im;
+        }
+
+        kernel.assign(2 * convolutionLength, 0.f);
+        const float scale = 1.f / static_cast<float>(convolutionLength);
+        for (size_t k = 0; k < n; k++) {
+            const float re = chirp[2 * k] * scale;
+            const float im = -chirp[2 * k + 1] * scale;
+            kernel[2 * k] = re;
+            kernel[2 * k + 1] = im;
+            if (k != 0) {
+                kernel[2 * (convolutionLength - k)] = re;
+                kernel[2 * (convolutionLength - k) + 1] = im;
+            }
+        }
+        std::vector<float> work(convolution->scratchSize());
+        convolution->forward(kernel.data(), work.data());
+        return;
+    }
+
+    size_t m = n;
+    size_t s = 1;
+    for (size_t radix : radices) {
+        m /= radix;
+        Stage stage{radix, m, s, std::vector<float>(2 * (radix - 1) * m)};
+        const double theta = -2. * PI / static_cast<double>(m * radix);
+        for (size_t r = 1; r < radix; r++) {
+            for (size_t p = 0; p < m; p++) {
+                const Complex w = polar(theta * static_cast<double>(r * p));
+                stage.twiddles[2 * ((r - 1) * m + p)] = w.re;
+                stage.twiddles[2 * ((r - 1) * m + p) + 1] = w.im;
+            }
+        }
+        stages.push_back(std::move(stage));
+        s *= radix;
+    }
+}
+
+size_t FFTPlan::scratchSize() const {
+    if (convolution)
+        return 2 * convolution->length() + convolution->scratchSize();
+    return 2 * n;
+}
+
+void FFTPlan::execute(float* data, float* scratch, bool inverse) const {
+    if (!inverse) {
+        forward(data, scratch);
+        return;
+    }
+
+    // ifft(x) = conj(fft(conj(x))) / n
+    for (size_t i = 1; i < 2 * n; i += 2)
+        data[i] = -data[i];
+    forward(data, scratch);
+    const float scale = 1.f / static_cast<float>(n);
+    for (size_t i = 0; i < 2 * n; i += 2) {
+        data[i] *= scale;
+        data[i + 1] *= -scale;
+    }
+}
+
+void FFTPlan::forward(float* data, float* work) const {
+    if (convolution) {
+        bluestein(data, work);
+        return;
+    }
+
+    auto* x = reinterpret_cast<Complex*>(data);
+    auto* y = reinterpret_cast<Complex*>(work);
+    for (const auto& stage : stages) {
+        const auto* w = reinterpret_cast<const Complex*>(stage.twiddles.data());
+        switch (stage.radix) {
+        case 4:
+            stockhamStage<4>(x, y, stage.m, stage.s, w, butterfly4);
+            break;
+        case 2:
+            stockhamStage<2>(x, y, stage.m, stage.s, w, butterfly2);
+            break;
+        case 3:
+            stockhamStage<3>(x, y, stage.m, stage.s, w, butterfly3);
+            break;
+        default:
+            stockhamStage<5>(x, y, stage.m, stage.s, w, butterfly5);
+            break;
+        }
+        std::swap(x, y);
+    }
+    if (x != reinterpret_cast<Complex*>(data))
+        std::memcpy(data, x, 2 * n * sizeof(float));
+}
+
+void FFTPlan::bluestein(float* data, float* work) const {
+    const size_t convolutionLength = convolution->length();
+    auto* x = reinterpret_cast<Complex*>(data);
+    auto* a = reinterpret_cast<Complex*>(work);
+    float* convolutionWork = work + 2 * convolutionLength;
+    const auto* c = reinterpret_cast<const Complex*>(chirp.data());
+    const auto* b = reinterpret_cast<const Complex*>(kernel.data());
+
+    for (size_t k = 0; k < n; k++)
+        a[k] = mul(x[k], c[k]);
+    std::fill(a + n, a + convolutionLength, Complex{0.f, 0.f});
+
+    convolution->forward(reinterpret_cast<float*>(a), convolutionWork);
+    // the inverse transform of the product is computed as conj(fft(conj(a * b)))
+    for (size_t k = 0; k < convolutionLength; k++)
+        a[k] = conj(mul(a[k], b[k]));
+    convolution->forward(reinterpret_cast<float*>(a), convolutionWork);
+
+    for (size_t k = 0; k < n; k++)
+        x[k] = mul(conj(a[k]), c[k]);
+}
+
+RealFFTPlan::RealFFTPlan(size_t length) : n(length), complexPlan(length % 2 == 0 ? length / 2 : length) {
+    if (n % 2 == 0) {
+        const size_t half = n / 2;
+        twiddles.resize(2 * (half + 1));
+        for (size_t k = 0; k <= half; k++) {
+            const Complex w = polar(-2. * PI * static_cast<double>(k) / static_cast<double>(n));
+            twiddles[2 * k] = w.re;
+            twiddles[2 * k + 1] = w.im;
+        }
+    }
+}
+
+size_t RealFFTPlan::scratchSize() const {
+    return 2 * complexPlan.length() + complexPlan.scratchSize();
+}
+
+void RealFFTPlan::forward(const float* src, float* dst, float* scratch) const {
+    auto* z = reinterpret_cast<Complex*>(scratch);
+    float* work = scratch + 2 * complexPlan.length();
+    auto* X = reinterpret_cast<Complex*>(dst);
+
+    if (n % 2 != 0) {
+        for (size_t k = 0; k < n; k++)
+            z[k] = {src[k], 0.f};
+        complexPlan.execute(reinterpret_cast<float*>(z), work, false);
+        std::copy(z, z + n / 2 + 1, X);
+        return;
+    }
+
+    // the even and the odd samples are packed to the real and the imaginary parts of the half length sequence
+    const size_t half = n / 2;
+    std::memcpy(z, src, n * sizeof(float));
+    complexPlan.execute(reinterpret_cast<float*>(z), work, false);
+
+    // X[k] = E[k] + w^k * O[k], where E[k] = (Z[k] + conj(Z[h - k])) / 2, O[k] = (Z[k] - conj(Z[h - k])) / 2i
+    const auto* w = reinterpret_cast<const Complex*>(twiddles.data());
+    for (size_t k = 0; k <= half; k++) {
+        const Complex zk = z[k == half ? 0 : k];
+        const Complex zc = conj(z[k == 0 ? 0 : half - k]);
+        const Complex even = (zk + zc) * 0.5f;
+        const Complex odd = mulByMinusI(zk - zc) * 0.5f;
+        X[k] = even + mul(w[k], odd);
+    }
+}
+
+void RealFFTPlan::inverse(const float* src, float* dst, float* scratch) const {
+    auto* z = reinterpret_cast<Complex*>(scratch);
+    float* work = scratch + 2 * complexPlan.length();
+    const auto* X = reinterpret_cast<const Complex*>(src);
+    const size_t half = n / 2;
+
+    if (n % 2 != 0) {
+        z[0] = {X[0].re, 0.f};
+        for (size_t k = 1; k <= half; k++) {
+            z[k] = X[k];
+            z[n - k] = conj(X[k]);
+        }
+        complexPlan.execute(reinterpret_cast<float*>(z), work, true);
+        for (size_t k = 0; k < n; k++)
+            dst[k] = z[k].re;
+        return;
+    }
+
+    // E[k] = (X[k] + conj(X[h - k])) / 2, O[k] = (X[k] - conj(X[h - k])) * conj(w^k) / 2, Z[k] = E[k] + i * O[k]
+    const auto* w = reinterpret_cast<const Complex*>(twiddles.data());
+    auto spectrum = [&](size_t k) {
+        return (k == 0 || k == half) ? Complex{X[k].re, 0.f} : X[k];
+    };
+    for (size_t k = 0; k < half; k++) {
+        const Complex xk = spectrum(k);
+        const Complex xc = conj(spectrum(half - k));
+        const Complex even = (xk + xc) * 0.5f;
+        const Complex odd = mul(xk - xc, conj(w[k])) * 0.5f;
+        z[k] = even - mulByMinusI(odd);
+    }
+    complexPlan.execute(reinterpret_cast<float*>(z), work, true);
+    std::memcpy(dst, z, n * sizeof(float));
+}
+
+void fftAlongAxis(float* data, const std::vector<size_t>& shape, size_t axis, const FFTPlan& plan, bool inverse) {
+    const size_t length = shape[axis];
+    const size_t inner = std::accumulate(shape.begin() + axis + 1, shape.end(), size_t(1), std::multiplies<size_t>());
+    const size_t outer = std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t lines = outer * inner;
+
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(lines, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> scratch(plan.scratchSize());
+        std::vector<float> line(inner == 1 ? 0 : 2 * length);
+        for (size_t l = start; l < end; l++) {
+            float* first = data + 2 * ((l / inner) * length * inner + l % inner);
+            if (inner == 1) {
+                plan.execute(first, scratch.data(), inverse);
+                continue;
+            }
+            for (size_t i = 0; i < length; i++) {
+                line[2 * i] = first[2 * i * inner];
+                line[2 * i + 1] = first[2 * i * inner + 1];
+            }
+            plan.execute(line.data(), scratch.data(), inverse);
+            for (size_t i = 0; i < length; i++) {
+                first[2 * i * inner] = line[2 * i];
+                first[2 * i * inner + 1] = line[2 * i + 1];
+            }
+        }
+    });
+}
+
+void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t>& inputShape, const std::vector<size_t>& inputStrides,
+                                    float* output, const std::vector<size_t>& outputShape, const std::vector<size_t>& outputStrides) {
+    auto totalInput = std::accumulate(inputShape.begin(), inputShape.end(), 1, std::multiplies<size_t>());
+    auto totalOutput = std::accumulate(outputShape.begin(), outputShape.end(), 1, std::multiplies<size_t>());
+    std::fill_n(output, totalOutput, 0);
+    size_t lastChangedDim = 0;
+    for (size_t index = inputShape.size() - 1; index > 0; --index) {
+        if (inputShape[index] != outputShape[index]) {
+            lastChangedDim = index;
+            break;
+        }
+    }
+    if (lastChangedDim == 0) {
+        size_t outputBytesSize = std::min(totalOutput, totalInput) * sizeof(float);
+        cpu_memcpy(output, input, outputBytesSize);
+        return;
+    }
+
+    std::vector<size_t> iterationRange(lastChangedDim + 1, 0);
+    for (size_t index = 0; index < lastChangedDim + 1; ++index) {
+        iterationRange[index] = std::min(inputShape[index], outputShape[index]);
+    }
+
+    const std::vector<size_t> inputStridesRange(inputStrides.begin(), inputStrides.begin() + iterationRange.size());
+    const std::vector<size_t> outputStridesRange(outputStrides.begin(), outputStrides.begin() + iterationRange.size());
+    const size_t blockSize = std::accumulate(inputShape.begin() + lastChangedDim + 1, inputShape.end(), 1ul, std::multiplies<size_t>());
+    const size_t blockSizeBytes = blockSize * sizeof(float);
+    std::vector<size_t> iterationCounter(iterationRange.size(), 0);
+    do {
+        size_t offsetInput = calculateOffsetFromStrides(iterationCounter, inputStrides);
+        size_t offsetOutput = calculateOffsetFromStrides(iterationCounter, outputStrides);
+        cpu_memcpy(output + offsetOutput, input + offsetInput, blockSizeBytes);
+    } while (copyStep(iterationCounter, iterationRange));
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
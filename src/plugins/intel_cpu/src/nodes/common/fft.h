@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Plan of the complex FFT of a fixed length, the complex numbers are stored as interleaved (real, imag) pairs.
+ * The length is factorized into the radices 4, 2, 3 and 5 and the stages are computed with the Stockham autosort
+ * algorithm, so no bit reversal is needed. The lengths having other prime factors are computed with the Bluestein
+ * algorithm as a convolution of a 2-3-5 smooth length. The twiddles of all the stages are computed once by the plan.
+ */
+class FFTPlan {
+public:
+    explicit FFTPlan(size_t length);
+
+    size_t length() const {
+        return n;
+    }
+
+    /**
+     * @brief Number of floats of the scratch buffer required by execute()
+     */
+    size_t scratchSize() const;
+
+    /**
+     * @brief Computes the FFT of 'length' complex numbers in place, the inverse transform is normalized by 1 / length
+     * @param scratch buffer of scratchSize() floats
+     */
+    void execute(float* data, float* scratch, bool inverse) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // length of the sub-sequence of the stage
+        size_t m;
+        // stride of the sub-sequence of the stage
+        size_t s;
+        // w^(r * p), r = [1, radix), p = [0, m)
+        std::vector<float> twiddles;
+    };
+
+    // unnormalized forward transform, the result is in data
+    void forward(float* data, float* work) const;
+    void bluestein(float* data, float* work) const;
+
+    size_t n;
+    std::vector<Stage> stages;
+
+    // Bluestein: chirp exp(-i * pi * k^2 / n), the FFT of the convolution kernel and the plan of the convolution
+    std::vector<float> chirp;
+    std::vector<float> kernel;
+    std::unique_ptr<FFTPlan> convolution;
+};
+
+/**
+ * @brief Plan of the FFT of a real sequence, only the first length / 2 + 1 complex numbers of the spectrum are stored,
+ * the rest is defined by the conjugate symmetry. An even length is computed as the complex FFT of the half length.
+ */
+class RealFFTPlan {
+public:
+    explicit RealFFTPlan(size_t length);
+
+    size_t length() const {
+        return n;
+    }
+
+    size_t scratchSize() const;
+
+    /**
+     * @brief Computes length / 2 + 1 complex numbers of the spectrum of 'length' real numbers
+     */
+    void forward(const float* src, float* dst, float* scratch) const;
+
+    /**
+     * @brief Computes 'length' real numbers from length / 2 + 1 complex numbers of the spectrum, the imaginary parts of
+     * the zero and the Nyquist frequencies are ignored. The result is normalized by 1 / length.
+     */
+    void inverse(const float* src, float* dst, float* scratch) const;
+
+private:
+    size_t n;
+    FFTPlan complexPlan;
+    // exp(-2 * pi * i * k / n), k = [0, n / 2], for the even length
+    std::vector<float> twiddles;
+};
+
+/**
+ * @brief Computes the complex FFT of every line of the dense complex tensor along the axis in place, the lines are
+ * processed in parallel
+ * @param shape shape of the tensor without the last dimension of the real and the imaginary parts
+ */
+void fftAlongAxis(float* data, const std::vector<size_t>& shape, size_t axis, const FFTPlan& plan, bool inverse);
+
+/**
+ * @brief Copies the tensor to the output of other shape: the dimensions are trimmed or padded with zeros at the end
+ */
+void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t>& inputShape, const std::vector<size_t>& inputStrides,
+                                    float* output, const std::vector<size_t>& outputShape, const std::vector<size_t>& outputStrides);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -2,21 +2,125 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
 #include <vector>
 #include <string>
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+#include <xmmintrin.h>
+#endif
 #include <mkldnn_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_emb_row_call_args, field)
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+// acc = (accumulate ? acc : 0) + (row - zero_point) * scale for work_amount elements of the row converted to f32,
+// work_amount is a multiple of the vector length
+template <cpu_isa_t isa>
+struct jit_uni_emb_row_kernel_f32 : public jit_uni_emb_row_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_row_kernel_f32)
+
+    explicit jit_uni_emb_row_kernel_f32(jit_emb_row_config_params jcp) : jit_uni_emb_row_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_acc, ptr[reg_params + GET_OFF(acc)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_aux, ptr[reg_params + GET_OFF(scale)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_aux]);
+        if (jcp_.with_zero_point) {
+            mov(reg_aux, ptr[reg_params + GET_OFF(zero_point)]);
+            uni_vbroadcastss(vmm_zero_point, ptr[reg_aux]);
+        }
+
+        L(loop_label); {
+            cmp(reg_work_amount, step);
+            jl(loop_end_label, T_NEAR);
+
+            load_row(vmm_val);
+            if (jcp_.with_zero_point)
+                uni_vsubps(vmm_val, vmm_val, vmm_zero_point);
+            if (jcp_.accumulate)
+                uni_vfmadd213ps(vmm_val, vmm_scale, ptr[reg_acc]);
+            else
+                uni_vmulps(vmm_val, vmm_val, vmm_scale);
+            uni_vmovups(ptr[reg_acc], vmm_val);
+
+            add(reg_src, step * jcp_.src_prc.size());
+            add(reg_acc, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(loop_end_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional<isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_acc = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_aux = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_zero_point = Vmm(2);
+
+    inline void load_row(Vmm vmm) {
+        switch (jcp_.src_prc) {
+            case Precision::FP32:
+                uni_vmovups(vmm, ptr[reg_src]);
+                break;
+            case Precision::BF16:
+                uni_vpmovzxwd(vmm, ptr[reg_src]);
+                uni_vpslld(vmm, vmm, 16);
+                break;
+            case Precision::U8:
+                vpmovzxbd(vmm, ptr[reg_src]);
+                uni_vcvtdq2ps(vmm, vmm);
+                break;
+            case Precision::I8:
+                vpmovsxbd(vmm, ptr[reg_src]);
+                uni_vcvtdq2ps(vmm, vmm);
+                break;
+            default:
+                assert(!"unsupported embedding table precision");
+        }
+    }
+};
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,21 +143,165 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::setTableDecompression(std::vector<float> scales, std::vector<float> zeroPoints) {
+    _scales = std::move(scales);
+    _zeroPoints = std::move(zeroPoints);
+}
+
+Precision EmbeddingBagSum::getDataPrecision(Precision tablePrecision, Precision outPrecision) const {
+    if (_scales.empty())
+        return tablePrecision;
+    return outPrecision == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(Precision tablePrecision) const {
+    // the f32, bf16 and the dequantized int8 rows are accumulated in f32 by the JIT kernels
+    if (!one_of(tablePrecision, Precision::FP32, Precision::BF16) && _scales.empty())
+        return impl_desc_type::ref_any;
+    if (mayiuse(x64::avx512_core))
+        return impl_desc_type::jit_avx512;
+    if (mayiuse(x64::avx2))
+        return impl_desc_type::jit_avx2;
+    return impl_desc_type::ref_any;
+}
+
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, Precision tablePrecision) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (_copyRowKernel || getImplType(tablePrecision) == impl_desc_type::ref_any)
+        return;
+
+    auto createKernel = [&](bool accumulate) {
+        jit_emb_row_config_params jcp;
+        jcp.src_prc = tablePrecision;
+        jcp.with_zero_point = !_zeroPoints.empty();
+        jcp.accumulate = accumulate;
+        std::shared_ptr<jit_uni_emb_row_kernel> kernel;
+        if (mayiuse(x64::avx512_core)) {
+            kernel.reset(new jit_uni_emb_row_kernel_f32<x64::avx512_core>(jcp));
+            _kernelStep = cpu_isa_traits<x64::avx512_core>::vlen / sizeof(float);
+        } else {
+            kernel.reset(new jit_uni_emb_row_kernel_f32<x64::avx2>(jcp));
+            _kernelStep = cpu_isa_traits<x64::avx2>::vlen / sizeof(float);
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+    _copyRowKernel = createKernel(false);
+    _addRowKernel = createKernel(true);
 }
 
-template<typename T>
-void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dstData,
+namespace {
+
+constexpr size_t cacheLineSize = 64lu;
+// number of the rows requested from memory ahead of the accumulated one
+constexpr size_t prefetchDistance = 8lu;
+
+inline void prefetchRow(const void* row, size_t rowBytes) {
+    const char* ptr = static_cast<const char*>(row);
+    for (size_t offset = 0lu; offset < rowBytes; offset += cacheLineSize) {
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(ptr + offset);
+#endif
+    }
+}
+
+// bf16 rows are accumulated in f32 and rounded once per bag
+template <typename T>
+struct EmbeddingAccumulator {
+    using type = T;
+};
+
+template <>
+struct EmbeddingAccumulator<bfloat16_t> {
+    using type = float;
+};
+
+template <typename T>
+inline T* getAccumulatorRow(T* dst, std::vector<T>&) {
+    return dst;
+}
+
+inline float* getAccumulatorRow(bfloat16_t*, std::vector<float>& buffer) {
+    return buffer.data();
+}
+
+template <typename T>
+inline void storeAccumulatorRow(T*, const T*, size_t) {}
+
+inline void storeAccumulatorRow(bfloat16_t* dst, const float* acc, size_t size) {
+    for (size_t i = 0lu; i < size; i++)
+        dst[i] = bfloat16_t(acc[i]);
+}
+
+// the kernels accumulate the rows in f32 only, returns the number of the elements processed by the kernel
+template <typename A>
+inline size_t runRowKernel(const jit_uni_emb_row_kernel*, A*, const void*, const A*, const A*, size_t) {
+    return 0lu;
+}
+
+inline size_t runRowKernel(const jit_uni_emb_row_kernel* kernel, float* acc, const void* row,
+                           const float* scale, const float* zeroPoint, size_t workAmount) {
+    auto args = jit_emb_row_call_args();
+    args.src = row;
+    args.acc = acc;
+    args.scale = scale;
+    args.zero_point = zeroPoint;
+    args.work_amount = workAmount;
+    (*kernel)(&args);
+    return workAmount;
+}
+
+}   // namespace
+
+template<typename src_t, typename acc_t>
+void EmbeddingBagSum::accumulateRow(acc_t* acc, const src_t* row, acc_t scale, acc_t zeroPoint, bool first) const {
+    const auto kernel = first ? _copyRowKernel.get() : _addRowKernel.get();
+    size_t i = 0lu;
+    if (kernel)
+        i = runRowKernel(kernel, acc, row, &scale, &zeroPoint, _embDepth / _kernelStep * _kernelStep);
+    for (; i < _embDepth; i++) {
+        const acc_t value = (static_cast<acc_t>(row[i]) - zeroPoint) * scale;
+        acc[i] = first ? value : acc[i] + value;
+    }
+}
+
+template<typename src_t, typename dst_t>
+void EmbeddingBagSum::processData(const src_t* srcData, const dst_t* weightsData, dst_t* dstData,
                                   const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    using acc_t = typename EmbeddingAccumulator<dst_t>::type;
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    const size_t tableSize = inDataDims[0];
+    const size_t rowBytes = _embDepth * sizeof(src_t);
+
+    // the dequantization parameters of the table row
+    auto rowParam = [](const std::vector<float>& params, size_t idx) {
+        return static_cast<acc_t>(params.size() == 1lu ? params[0] : params[idx]);
+    };
+
+    struct Bag {
+        const int* indices = nullptr;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    auto prefetchBag = [&](const Bag& bag, size_t from, size_t to) {
+        for (size_t i = from; i < std::min(to, bag.size); i++) {
+            const size_t idx = static_cast<size_t>(bag.indices[i]);
+            if (idx < tableSize)
+                prefetchRow(srcData + idx * _embDepth, rowBytes);
+        }
+    };
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
@@ -61,79 +309,97 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData, T* dst
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        std::vector<acc_t> accBuffer(std::is_same<dst_t, acc_t>::value ? 0lu : _embDepth);
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        auto fetchBag = [&](size_t obi, Bag& bag) {
+            bag.withWeights = _withWeights;
+            getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+            bag.withWeights = bag.withWeights & _withWeights;
+            if (bag.indices == nullptr)
+                bag.size = 0lu;
+        };
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+        Bag bag, nextBag;
+        fetchBag(start, nextBag);
+        prefetchBag(nextBag, 0lu, prefetchDistance);
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
+        for (size_t obi = start; obi < end; obi++) {
+            dst_t* dst = dstData + obi * _embDepth;
+            bag = nextBag;
+            // the first rows of the next bag are loaded while the current one is accumulated
+            if (obi + 1lu < end) {
+                fetchBag(obi + 1lu, nextBag);
+                prefetchBag(nextBag, 0lu, prefetchDistance);
+            }
+
+            if (bag.indices == nullptr) {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dst[i] = 0;
                 }
+                continue;
+            }
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
+            acc_t* acc = getAccumulatorRow(dst, accBuffer);
+            int weightsIdx = bag.weightsIdx;
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                const size_t idx = static_cast<size_t>(bag.indices[inIdx]);
+                if (idx >= tableSize) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]);
                 }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                prefetchBag(bag, inIdx + prefetchDistance, inIdx + prefetchDistance + 1lu);
+
+                acc_t scale = bag.withWeights ? static_cast<acc_t>(weightsData[weightsIdx++]) : static_cast<acc_t>(1);
+                acc_t zeroPoint = 0;
+                if (!_scales.empty()) {
+                    scale *= rowParam(_scales, idx);
+                    if (!_zeroPoints.empty())
+                        zeroPoint = rowParam(_zeroPoints, idx);
                 }
+                accumulateRow(acc, srcData + idx * _embDepth, scale, zeroPoint, inIdx == 0lu);
             }
+            storeAccumulatorRow(dst, acc, _embDepth);
         }
     };
 
     parallel_nt(0, threadBody);
 }
 
-void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
+template<typename src_t>
+void EmbeddingBagSum::processCompressedData(const src_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                            const InferenceEngine::Precision &dstPrc,
+                                            const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (dstPrc == Precision::BF16) {
+        processData(srcData, reinterpret_cast<const bfloat16_t*>(weightsData), reinterpret_cast<bfloat16_t*>(dstData), inDims, outDims);
+    } else {
+        processData(srcData, reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
+    }
+}
+
+void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                              const InferenceEngine::Precision &srcPrc, const InferenceEngine::Precision &dstPrc,
                               const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
     switch (srcPrc) {
         case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
+            return processData(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
         }
+        case Precision::BF16: {
+            return processData(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const bfloat16_t*>(weightsData), reinterpret_cast<bfloat16_t*>(dstData), inDims, outDims);
+        }
         case Precision::I8: {
-            return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
+            if (!_scales.empty())
+                return processCompressedData(reinterpret_cast<const int8_t*>(srcData), weightsData, dstData, dstPrc, inDims, outDims);
+            return processData(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
         }
         case Precision::U8: {
-            return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData, inDims, outDims);
+            if (!_scales.empty())
+                return processCompressedData(srcData, weightsData, dstData, dstPrc, inDims, outDims);
+            return processData(srcData, weightsData, dstData, inDims, outDims);
         }
         case Precision::I32: {
-            return processData<PrecisionTrait<Precision::I32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
+            return processData(reinterpret_cast<const int32_t*>(srcData),
                     reinterpret_cast<const int32_t*>(weightsData), reinterpret_cast<int32_t*>(dstData), inDims, outDims);
         }
         default: {
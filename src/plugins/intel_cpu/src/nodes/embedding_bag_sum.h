@@ -9,11 +9,44 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cassert>
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_emb_row_config_params {
+    InferenceEngine::Precision src_prc;
+    // subtract the zero point of the dequantized table row
+    bool with_zero_point;
+    // add the row to the accumulator, otherwise the accumulator is initialized by the row
+    bool accumulate;
+};
+
+struct jit_emb_row_call_args {
+    const void* src;
+    float* acc;
+    const float* scale;
+    const float* zero_point;
+    size_t work_amount;
+};
+
+struct jit_uni_emb_row_kernel {
+    void (*ker_)(const jit_emb_row_call_args *);
+
+    void operator()(const jit_emb_row_call_args *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_row_kernel(jit_emb_row_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_row_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_row_config_params jcp_;
+};
+
 class EmbeddingBagSum {
 public:
     EmbeddingBagSum(
@@ -23,10 +56,17 @@ public:
             size_t perSampleWeightsIdx,
             size_t defaultIndexIdx);
 
-    void execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
+    void execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                 const InferenceEngine::Precision &srcPrc, const InferenceEngine::Precision &dstPrc,
                  const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims);
 
-    ~EmbeddingBagSum() = default;
+    /**
+     * @brief Keeps the u8/i8 embedding table compressed: the row r is dequantized as (row - zeroPoints[r]) * scales[r]
+     * while it is accumulated. The scales (zero points) are given per table row or for the whole table.
+     */
+    void setTableDecompression(std::vector<float> scales, std::vector<float> zeroPoints);
+
+    virtual ~EmbeddingBagSum() = default;
 
 protected:
     virtual void initFromInputs() = 0;
@@ -37,11 +77,24 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, InferenceEngine::Precision tablePrecision);
 
-    template<typename T>
-    void processData(const T* srcData, const T* weightsData, T* dstData,
+    // precision of the per sample weights and of the output for the given table precision
+    InferenceEngine::Precision getDataPrecision(InferenceEngine::Precision tablePrecision,
+                                                InferenceEngine::Precision outPrecision) const;
+    impl_desc_type getImplType(InferenceEngine::Precision tablePrecision) const;
+
+    template<typename src_t, typename dst_t>
+    void processData(const src_t* srcData, const dst_t* weightsData, dst_t* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    // the rows of the compressed table are dequantized to the f32 (bf16) output
+    template<typename src_t>
+    void processCompressedData(const src_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                               const InferenceEngine::Precision &dstPrc,
+                               const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims);
+    // acc = (first ? 0 : acc) + (row - zeroPoint) * scale, the f32 (bf16, dequantized int8) rows go to the JIT kernel
+    template<typename src_t, typename acc_t>
+    void accumulateRow(acc_t* acc, const src_t* row, acc_t scale, acc_t zeroPoint, bool first) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +104,15 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    // the dequantization parameters of the compressed table, empty if the table is not compressed
+    std::vector<float> _scales;
+    std::vector<float> _zeroPoints;
+
+    std::shared_ptr<jit_uni_emb_row_kernel> _copyRowKernel;
+    std::shared_ptr<jit_uni_emb_row_kernel> _addRowKernel;
+    // number of the row elements processed by one iteration of the kernels
+    size_t _kernelStep = 0;
 };
 
 }   // namespace node
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -50,11 +51,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -65,6 +64,8 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
+    // the per sample weights and the output of the compressed table are f32 (bf16)
+    const auto dataPrecision = getDataPrecision(inDataPrecision, getOriginalOutputPrecisionAtPort(0));
     std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32},
@@ -72,13 +73,14 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
-        inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
+        inDataConfigurators.push_back({LayoutType::ncsp, dataPrecision});
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, dataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingSegmentsSum::initFromInputs() {
@@ -104,24 +106,20 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    // segment ids are sorted, so the bag is the range of the equal ids
+    const auto segment = std::equal_range(segmentIds_, segmentIds_ + indicesSize_, embIndex);
+    size = static_cast<size_t>(segment.second - segment.first);
+    if (size != 0) {
+        weightsIdx = static_cast<int>(segment.first - segmentIds_);
+        indices = indices_ + weightsIdx;
+        return;
     }
 
     // Empty bag
-    if (size == 0) {
-        size = 1lu;
-        withWeight = false;
-        if (defaultIndices_)
-            indices = defaultIndices_;
-        return;
-    }
+    size = 1lu;
+    withWeight = false;
+    if (defaultIndices_)
+        indices = defaultIndices_;
 }
 
 std::vector<VectorDims> EmbeddingSegmentsSum::shapeInfer() const {
@@ -144,8 +142,9 @@ void EmbeddingSegmentsSum::execute(mkldnn::stream strm) {
         weightsData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(PER_SAMPLE_WEIGHTS_IDX)->getMemoryPtr()->GetPtr());
 
     const auto &inputMem  = getParentEdgeAt(0)->getMemory();
-    EmbeddingBagSum::execute(srcData, weightsData, dstData, inputMem .getDesc().getPrecision(),
-                                       inputMem .getStaticDims(), getChildEdgesAtPort(0)[0]->getMemory().GetShape().getStaticDims());
+    const auto &outputMem = getChildEdgesAtPort(0)[0]->getMemory();
+    EmbeddingBagSum::execute(srcData, weightsData, dstData, inputMem .getDesc().getPrecision(), outputMem.getDesc().getPrecision(),
+                                       inputMem .getStaticDims(), outputMem.GetShape().getStaticDims());
 }
 
 bool EmbeddingSegmentsSum::created() const {
@@ -7,6 +7,9 @@
 #include "fake_quantize.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <cstdio>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -164,6 +167,10 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the compressed weights are handled by the own implementation, oneDNN inner product is not used
+    if (useWeightsDecompression())
+        return;
+
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -220,6 +227,12 @@ void FullyConnected::prepareParams() {
             IE_THROW() << "Input memory hasn't been allocated.";
     }
 
+    if (useWeightsDecompression()) {
+        if (!decompressionExecutor)
+            prepareCompressedWeights();
+        return;
+    }
+
     const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
@@ -331,6 +344,9 @@ void FullyConnected::prepareParams() {
 void FullyConnected::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
 
+    if (useWeightsDecompression())
+        return;
+
     auto setBatchPrimArgs = [this](int argType, const mkldnn::memory& oldMem) {
         mkldnn::memory::desc newMemDesc(oldMem.get_desc());
         newMemDesc.data.dims[0] = batchToProcess();
@@ -349,7 +365,81 @@ void FullyConnected::setDynamicBatchLim(int lim) {
     setBatchPrimArgs(DNNL_ARG_DST, getChildEdgesAtPort(0)[0]->getMemory().GetPrimitive());
 }
 
+void FullyConnected::setWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groupSize) {
+    decompressionScales = std::move(scales);
+    decompressionZeroPoints = std::move(zeroPoints);
+    decompressionGroupSize = groupSize;
+}
+
+void FullyConnected::prepareCompressedWeights() {
+    const auto& wghMemory = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& wghDims = wghMemory.getStaticDims();
+    const size_t OC = wghDims[0];
+    const size_t IC = wghDims[1];
+    auto weightsPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+
+    // the int4 weights are widened to 8 bits by the transformations, they are packed back two per byte,
+    // so the kernel streams half of the weights; the packed copy is shared by the streams through the weights cache
+    packedWeights.reset();
+    if (FCWeightsDecompression::fitsInt4(weightsPrc, wghMemory.GetPtr(), OC * IC)) {
+        auto pack = [&] () {
+            MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+            ptr->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{OC, div_up(IC, 2)})));
+            FCWeightsDecompression::packToInt4(wghMemory.GetPtr(), static_cast<uint8_t*>(ptr->GetPtr()), OC, IC);
+            return ptr;
+        };
+
+        if (weightCache) {
+            char ptr[32];
+            snprintf(ptr, sizeof ptr, "%p", wghMemory.GetPtr());
+            const std::string key = getName() + "_int4_" + std::to_string(OC * IC) + "_" + ptr;
+            packedWeights = *weightCache->findOrCreate(key, pack);
+        } else {
+            packedWeights = pack();
+        }
+        weightsPrc = weightsPrc == Precision::U8 ? Precision::U4 : Precision::I4;
+    }
+
+    decompressionExecutor = std::make_shared<FCWeightsDecompression>(weightsPrc,
+                                                                     getParentEdgesAtPort(DATA_ID)[0]->getMemory().getDesc().getPrecision(),
+                                                                     getChildEdgesAtPort(0)[0]->getMemory().getDesc().getPrecision());
+}
+
+void FullyConnected::executeWithCompressedWeights() {
+    const auto& srcMemory = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& wghMemory = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    auto& dstMemory = getChildEdgesAtPort(0)[0]->getMemory();
+
+    const auto& srcDims = srcMemory.getStaticDims();
+    const auto& wghDims = wghMemory.getStaticDims();
+
+    FCCompressedWeights weights;
+    weights.OC = wghDims[0];
+    weights.IC = wghDims[1];
+    weights.groupSize = decompressionGroupSize;
+    if (packedWeights) {
+        weights.precision = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::U8 ? Precision::U4 : Precision::I4;
+        weights.weights = packedWeights->GetPtr();
+    } else {
+        weights.precision = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+        weights.weights = wghMemory.GetPtr();
+    }
+    weights.scales = decompressionScales.data();
+    weights.zeroPoints = decompressionZeroPoints.empty() ? nullptr : decompressionZeroPoints.data();
+    if (withBiases)
+        weights.bias = reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr());
+
+    const size_t batch = dynBatchLim > 0 ? static_cast<size_t>(batchToProcess()) : srcDims[0];
+    const size_t M = batch * std::accumulate(srcDims.begin() + 1, srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    decompressionExecutor->execute(weights, srcMemory.GetPtr(), dstMemory.GetPtr(), M);
+}
+
 void FullyConnected::execute(mkldnn::stream strm) {
+    if (useWeightsDecompression()) {
+        executeWithCompressedWeights();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -377,6 +467,9 @@ void FullyConnected::executeDynamicImpl(mkldnn::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // post ops are not supported by the implementation for the compressed weights
+    if (useWeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -522,6 +615,9 @@ void FullyConnected::createDescriptorInternal(const mkldnn::memory::desc &inputD
 
 void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useWeightsDecompression())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -543,6 +639,23 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useWeightsDecompression()) {
+        // the bf16 activations are consumed and produced as is, without the reorders to f32
+        auto srcPrc = getOriginalInputPrecisionAtPort(DATA_ID);
+        auto dstPrc = getOriginalOutputPrecisionAtPort(0);
+        if (!one_of(srcPrc, Precision::FP32, Precision::BF16))
+            srcPrc = Precision::FP32;
+        if (!one_of(dstPrc, Precision::FP32, Precision::BF16))
+            dstPrc = Precision::FP32;
+
+        std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, srcPrc},
+                                              {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, dstPrc}}, FCWeightsDecompression::getImplType(), true);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "common/fc_weights_decompression.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -56,6 +57,18 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * @brief Switches the node to the weights compressed to 8 bits, the weights are decompressed as
+     * (weights - zeroPoints) * scales on the fly during the execution
+     * @param scales per output channel ([OC]) or per group of the input channels ([OC, IC / groupSize]) scales
+     * @param zeroPoints zero points of the same shape as scales, empty for the symmetric quantization
+     * @param groupSize number of the input channels sharing the same scale and zero point
+     */
+    void setWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groupSize);
+    bool useWeightsDecompression() const {
+        return !decompressionScales.empty();
+    }
+
 private:
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
@@ -67,9 +80,18 @@ private:
     VectorDims outDims;
 
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
+    void prepareCompressedWeights();
+    void executeWithCompressedWeights();
 
     bool withBiases = false;
 
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    size_t decompressionGroupSize = 0;
+    std::shared_ptr<FCWeightsDecompression> decompressionExecutor;
+    // the weights fitting into 4 bits packed two per byte, empty if the 8-bit weights are used as is
+    MemoryPtr packedWeights;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
@@ -350,13 +350,26 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // The constant data is used in place if it doesn't need any conversion, so the weights mapped from the IR file
+    // stay in the page cache shared between the processes instead of being copied to the private memory
+    auto canShareBlob = [&] () {
+        return constOp->get_byte_size() >= memDesc.getCurrentMemSize() && isBlobAligned() && !hasSubnormals() && !isWA();
+    };
+
+    auto shareBlob = [&, this] () {
+        MemoryPtr ptr = MemoryPtr(new Memory(getEngine()));
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        return ptr;
+    };
+
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // the key contains the data pointer, so a view is shared only by the nodes holding the same constant data
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), [&] () {
+            return canShareBlob() ? shareBlob() : cloneBlob();
+        });
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
-        auto ptr = new Memory(getEngine());
-        ptr->Create(memDesc, constOp->get_data_ptr());
-        memoryPtr = MemoryCPtr(ptr);
+    } else if (canShareBlob()) {
+        memoryPtr = std::const_pointer_cast<const Memory>(shareBlob());
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
     }
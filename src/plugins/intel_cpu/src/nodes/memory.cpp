@@ -106,7 +106,7 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
 }
 
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache)
-        : Input(op, eng, cache), MemoryNode(op), dataStore(new Memory{eng}) {
+        : Input(op, eng, cache), MemoryNode(op), dataStore(new Memory{eng}), activeStore(dataStore) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -152,18 +152,32 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::bindState(void* data) {
+    if (!boundStore) {
+        boundStore = std::make_shared<Memory>(getEngine());
+        boundStore->Create(dataStore->getDesc(), data, false);
+    } else if (boundStore->GetData() != data) {
+        boundStore->setDataHandle(data);
+    }
+    activeStore = boundStore;
+}
+
+void MemoryInput::unbindState() {
+    activeStore = dataStore;
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*activeStore, new_state);
 }
 
 void MemoryInput::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *activeStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -103,8 +103,17 @@ public:
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief Makes the node read and update the state in the external buffer of the same size instead of the own
+     * storage, until unbindState() is called. The own storage is kept intact.
+     */
+    void bindState(void* data);
+    void unbindState();
  private:
     MemoryPtr dataStore;
+    // the memory on the external state buffer and the memory used by the node (the own or the external one)
+    MemoryPtr boundStore;
+    MemoryPtr activeStore;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
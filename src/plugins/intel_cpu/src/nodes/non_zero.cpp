@@ -5,6 +5,8 @@
 #include "non_zero.h"
 #include <ngraph/opsets/opset3.hpp>
 #include <utils/bfloat16.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
 
 using namespace InferenceEngine;
 
@@ -61,22 +63,31 @@ void NonZero::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref);
 }
 
+namespace {
+// the input is split into the blocks of at least this number of elements per thread
+constexpr size_t minElementsPerThread = 32 * 1024;
+
+template <typename T>
+inline bool isNonZero(const T value) {
+    return value != T(0);
+}
+
+template <>
+inline bool isNonZero<bfloat16_t>(const bfloat16_t value) {
+    // +0 and -0 are zeros, the bits are compared to avoid the conversion to float
+    return (value.to_bits() & 0x7FFF) != 0;
+}
+}   // namespace
+
 template <typename T>
-size_t NonZero::getNonZeroElementsCount(const T* src, const Shape& inShape) {
-    T zero = 0;
+size_t NonZero::getNonZeroElementsCount(const T* src, size_t size) {
     size_t count = 0;
-    size_t inSize = inShape.getElementsCount();
-    if (inShape.getRank() == 0) {
-        if (src[0] != zero)
-            count = 1;
-    } else {
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero)
-                count++;
-        }
-    }
+    // branchless, so that the loop is vectorized
+    for (size_t i = 0; i < size; i++)
+        count += isNonZero(src[i]);
     return count;
 }
+
 namespace {
 struct NonZeroContext {
     NonZero &node;
@@ -106,38 +117,72 @@ void NonZero::execute(mkldnn::stream strm) {
 }
 template <typename T>
 void NonZero::executeSpecified() {
-    T zero = 0;
-    T *src = reinterpret_cast<T *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const T *src = reinterpret_cast<const T *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     auto dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     Shape inShape = getParentEdgeAt(0)->getMemory().GetShape();
     size_t inRank = inShape.getRank();
-    size_t nonZeroCount = getNonZeroElementsCount(src, inShape);
+    size_t inSize = inShape.getElementsCount();
+
+    // Each thread counts the non-zero elements of its contiguous block, the prefix sum of the counts gives the first
+    // output column of every block, then the threads write the coordinates of their blocks independently.
+    // parallel_for is used instead of parallel_nt, so that every block is processed even if fewer threads are given.
+    const size_t threadsNum = std::max<size_t>(1, std::min<size_t>(parallel_get_max_threads(), inSize / minElementsPerThread));
+    std::vector<size_t> blockOffsets(threadsNum + 1, 0);
+    parallel_for(threadsNum, [&](size_t ithr) {
+        size_t start = 0, end = 0;
+        splitter(inSize, threadsNum, ithr, start, end);
+        blockOffsets[ithr + 1] = getNonZeroElementsCount(src + start, end - start);
+    });
+    for (size_t i = 1; i <= threadsNum; i++)
+        blockOffsets[i] += blockOffsets[i - 1];
+    const size_t nonZeroCount = blockOffsets[threadsNum];
 
     if (isDynamicNode()) {
         VectorDims newDims{inRank, nonZeroCount};
         redefineOutputMemory({newDims});
     }
     int *dst = reinterpret_cast<int *>(dstMemPtr->GetPtr());
-    size_t inSize = inShape.getElementsCount();
-    auto srcStrides = getParentEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     if (nonZeroCount == 0)
         return;
-    if (inShape.getRank() == 0) {
+    if (inRank == 0) {
         dst[0] = 0;
-    } else {
-        size_t colIndex = 0, outIndex = 0;
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero) {
-                size_t temp = i;
-                for (size_t j = 0; j < inRank; j++) {
-                    outIndex = j * nonZeroCount + colIndex;
-                    dst[outIndex] = temp / srcStrides[j];
-                    temp = temp % srcStrides[j];
-                }
+        return;
+    }
+
+    const auto& inDims = inShape.getStaticDims();
+    parallel_for(threadsNum, [&](size_t ithr) {
+        size_t colIndex = blockOffsets[ithr];
+        if (colIndex == blockOffsets[ithr + 1])
+            return;
+        size_t start = 0, end = 0;
+        splitter(inSize, threadsNum, ithr, start, end);
+        if (inRank == 1) {
+            for (size_t i = start; i < end; i++) {
+                if (isNonZero(src[i]))
+                    dst[colIndex++] = static_cast<int>(i);
+            }
+            return;
+        }
+
+        // the coordinates of the first element of the block, then they are incremented along with the linear index
+        VectorDims coords(inRank);
+        for (size_t j = inRank, temp = start; j-- > 0;) {
+            coords[j] = temp % inDims[j];
+            temp /= inDims[j];
+        }
+        for (size_t i = start; i < end; i++) {
+            if (isNonZero(src[i])) {
+                for (size_t j = 0; j < inRank; j++)
+                    dst[j * nonZeroCount + colIndex] = static_cast<int>(coords[j]);
                 colIndex++;
             }
+            for (size_t j = inRank; j-- > 0;) {
+                if (++coords[j] < inDims[j])
+                    break;
+                coords[j] = 0;
+            }
         }
-    }
+    });
 }
 
 bool NonZero::created() const {
@@ -36,7 +36,7 @@ private:
     template<typename T>
     struct NonZeroExecute;
     template <typename T>
-    size_t getNonZeroElementsCount(const T* arg, const Shape& arg_shape);
+    size_t getNonZeroElementsCount(const T* src, size_t size);
 };
 
 }   // namespace node
@@ -0,0 +1,290 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <numeric>
+
+#include "rdft.h"
+#include "ie_parallel.hpp"
+#include "ie_precision.hpp"
+#include <ngraph/opsets/opset9.hpp>
+
+using namespace mkldnn;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool RDFT::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        const auto rdft = std::dynamic_pointer_cast<const ngraph::opset9::RDFT>(op);
+        const auto irdft = std::dynamic_pointer_cast<const ngraph::opset9::IRDFT>(op);
+
+        if (!rdft && !irdft) {
+            errorMessage = "Only opset9 RDFT/IRDFT operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+RDFT::RDFT(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache) :
+               Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    inverse = std::dynamic_pointer_cast<ngraph::opset9::RDFT>(op) == nullptr;
+    layerErrorPrefix = std::string(inverse ? "IRDFT" : "RDFT") + " layer with name '" + op->get_name() + "'";
+    const size_t inputsNumber = getOriginalInputsNumber();
+    if (inputsNumber != 2 && inputsNumber != 3) {
+        IE_THROW() << layerErrorPrefix << " has invalid number of input/output edges: " << inputsNumber;
+    }
+
+    /* Data */
+    inputShape = inputShapes[DATA_INDEX].getStaticDims();
+    const size_t minRank = inverse ? 2 : 1;
+    if (inputShape.size() < minRank) {
+        IE_THROW() << layerErrorPrefix << " has invalid 'data' input tensor with rank: " << inputShape.size();
+    }
+
+    /* Axes */
+    const auto axesRank = inputShapes[AXES_INDEX].getRank();
+    if (axesRank != 1) {
+        IE_THROW() << layerErrorPrefix << " has invalid 'axes' input tensor with rank: " << axesRank;
+    }
+
+    /* Signal size */
+    if (inputsNumber > SIGNAL_SIZE_INDEX) {
+        const auto signalSizeRank = inputShapes[SIGNAL_SIZE_INDEX].getRank();
+        if (signalSizeRank != 1) {
+            IE_THROW() << layerErrorPrefix << " has invalid 'signal_size' input tensor with rank: " << signalSizeRank;
+        }
+    }
+}
+
+void RDFT::getSupportedDescriptors() {}
+
+void RDFT::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto& dataPrecision = getOriginalInputPrecisionAtPort(DATA_INDEX);
+    if (!dataPrecision.is_float()) {
+        IE_THROW() << layerErrorPrefix << " has unsupported 'data' input precision: " << dataPrecision.name();
+    }
+
+    const auto& axesPrecision = getOriginalInputPrecisionAtPort(AXES_INDEX);
+    if (axesPrecision != Precision::I32 && axesPrecision != Precision::I64) {
+        IE_THROW() << layerErrorPrefix << " has unsupported 'axes' input precision: " << axesPrecision.name();
+    }
+
+    if (inputShapes.size() > SIGNAL_SIZE_INDEX) {
+        const auto& signalSizeTensorPrec = getOriginalInputPrecisionAtPort(SIGNAL_SIZE_INDEX);
+        if (signalSizeTensorPrec != Precision::I32 && signalSizeTensorPrec != Precision::I64) {
+            IE_THROW() << layerErrorPrefix << " has unsupported 'signal_size' input precision: " << signalSizeTensorPrec.name();
+        }
+    }
+
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, Precision::FP32},
+                                                       {LayoutType::ncsp, Precision::I32}});
+    if (inputShapes.size() > SIGNAL_SIZE_INDEX)
+        inDataConfigurators.push_back({LayoutType::ncsp,  Precision::I32});
+
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any);
+}
+
+namespace {
+std::vector<size_t> getDenseStrides(const std::vector<size_t>& shape) {
+    std::vector<size_t> strides(shape.size(), 1);
+    for (size_t i = shape.size(); i > 1; --i) {
+        strides[i - 2] = strides[i - 1] * shape[i - 1];
+    }
+    return strides;
+}
+
+/*
+    The line l of the tensor along the axis starts at the element (l / inner) * shape[axis] * inner + l % inner
+    and has the stride inner, the lines are processed in parallel
+*/
+template <typename Body>
+void parallelLines(const std::vector<size_t>& shape, size_t axis, Body body) {
+    const size_t inner = std::accumulate(shape.begin() + axis + 1, shape.end(), size_t(1), std::multiplies<size_t>());
+    const size_t outer = std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t lines = outer * inner;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(lines, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+        body(start, end, inner);
+    });
+}
+
+// real input of 'shape' -> complex output with shape[axis] / 2 + 1 numbers along the axis
+void rfftAlongAxis(const float* input, float* output, const std::vector<size_t>& shape, size_t axis, const RealFFTPlan& plan) {
+    const size_t length = shape[axis];
+    const size_t spectrumLength = length / 2 + 1;
+    parallelLines(shape, axis, [&](size_t start, size_t end, size_t inner) {
+        std::vector<float> scratch(plan.scratchSize());
+        std::vector<float> src(inner == 1 ? 0 : length);
+        std::vector<float> dst(inner == 1 ? 0 : 2 * spectrumLength);
+        for (size_t l = start; l < end; l++) {
+            const float* first = input + (l / inner) * length * inner + l % inner;
+            float* outFirst = output + 2 * ((l / inner) * spectrumLength * inner + l % inner);
+            if (inner == 1) {
+                plan.forward(first, outFirst, scratch.data());
+                continue;
+            }
+            for (size_t i = 0; i < length; i++)
+                src[i] = first[i * inner];
+            plan.forward(src.data(), dst.data(), scratch.data());
+            for (size_t i = 0; i < spectrumLength; i++) {
+                outFirst[2 * i * inner] = dst[2 * i];
+                outFirst[2 * i * inner + 1] = dst[2 * i + 1];
+            }
+        }
+    });
+}
+
+// complex input with shape[axis] / 2 + 1 numbers along the axis -> real output of 'shape'
+void irfftAlongAxis(const float* input, float* output, const std::vector<size_t>& shape, size_t axis, const RealFFTPlan& plan) {
+    const size_t length = shape[axis];
+    const size_t spectrumLength = length / 2 + 1;
+    parallelLines(shape, axis, [&](size_t start, size_t end, size_t inner) {
+        std::vector<float> scratch(plan.scratchSize());
+        std::vector<float> src(inner == 1 ? 0 : 2 * spectrumLength);
+        std::vector<float> dst(inner == 1 ? 0 : length);
+        for (size_t l = start; l < end; l++) {
+            const float* first = input + 2 * ((l / inner) * spectrumLength * inner + l % inner);
+            float* outFirst = output + (l / inner) * length * inner + l % inner;
+            if (inner == 1) {
+                plan.inverse(first, outFirst, scratch.data());
+                continue;
+            }
+            for (size_t i = 0; i < spectrumLength; i++) {
+                src[2 * i] = first[2 * i * inner];
+                src[2 * i + 1] = first[2 * i * inner + 1];
+            }
+            plan.inverse(src.data(), dst.data(), scratch.data());
+            for (size_t i = 0; i < length; i++)
+                outFirst[i * inner] = dst[i];
+        }
+    });
+}
+} // namespace
+
+void RDFT::execute(mkldnn::stream strm) {
+    // the axes are counted without the dimension of the real and the imaginary parts
+    const size_t rank = inverse ? inputShape.size() - 1 : inputShape.size();
+    auto axesEdge = getParentEdgeAt(AXES_INDEX);
+    const auto* axesStartPtr = reinterpret_cast<const int32_t*>(axesEdge->getMemoryPtr()->GetPtr());
+    axes = std::vector<int32_t>(axesStartPtr, axesStartPtr + axesEdge->getMemory().getStaticDims()[0]);
+    for (auto& axis : axes) {
+        if (axis < 0) {
+            axis += rank;
+        }
+    }
+
+    signalSizes.clear();
+    if (inputShapes.size() > SIGNAL_SIZE_INDEX) {
+        auto signalSizeEdge = getParentEdgeAt(SIGNAL_SIZE_INDEX);
+        const auto* signalSizeStartPtr = reinterpret_cast<const int32_t*>(signalSizeEdge->getMemoryPtr()->GetPtr());
+        signalSizes = std::vector<int32_t>(signalSizeStartPtr, signalSizeStartPtr + signalSizeEdge->getMemory().getStaticDims()[0]);
+    }
+
+    outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const auto *input = reinterpret_cast<const float*>(getParentEdgeAt(DATA_INDEX)->getMemoryPtr()->GetPtr());
+    auto *output = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    if (std::accumulate(outputShape.begin(), outputShape.end(), size_t(1), std::multiplies<size_t>()) == 0)
+        return;
+
+    if (inverse) {
+        irdftNd(input, output);
+    } else {
+        rdftNd(input, output);
+    }
+}
+
+/*
+    The real FFT along the last of the axes computes the half of the spectrum, the complex FFT along the rest of the
+    axes is computed for the half only
+*/
+void RDFT::rdftNd(const float* input, float* output) {
+    const size_t lastAxis = axes.back();
+    const std::vector<size_t> complexShape(outputShape.begin(), outputShape.end() - 1);
+
+    // the signal sizes of the axes except the last one are the output dimensions
+    std::vector<size_t> realShape = complexShape;
+    realShape[lastAxis] = signalSizes.empty() || signalSizes.back() == -1 ? inputShape[lastAxis] : signalSizes.back();
+
+    const float* realInput = input;
+    if (realShape != inputShape) {
+        buffer.resize(std::accumulate(realShape.begin(), realShape.end(), size_t(1), std::multiplies<size_t>()));
+        copyDataToOutputWithSignalSize(input, inputShape, getDenseStrides(inputShape),
+                                       buffer.data(), realShape, getDenseStrides(realShape));
+        realInput = buffer.data();
+    }
+
+    rfftAlongAxis(realInput, output, realShape, lastAxis, getRealFFTPlan(realShape[lastAxis]));
+    for (size_t i = 0; i + 1 < axes.size(); i++) {
+        fftAlongAxis(output, complexShape, axes[i], getFFTPlan(complexShape[axes[i]]), false);
+    }
+}
+
+/*
+    The input is trimmed or padded to length / 2 + 1 complex numbers along the last of the axes, as the rest of the
+    spectrum is defined by the conjugate symmetry
+*/
+void RDFT::irdftNd(const float* input, float* output) {
+    const size_t lastAxis = axes.back();
+    std::vector<size_t> complexShape = outputShape;
+    complexShape[lastAxis] = outputShape[lastAxis] / 2 + 1;
+
+    std::vector<size_t> paddedShape = complexShape;
+    paddedShape.push_back(2);
+    buffer.resize(std::accumulate(paddedShape.begin(), paddedShape.end(), size_t(1), std::multiplies<size_t>()));
+    copyDataToOutputWithSignalSize(input, inputShape, getDenseStrides(inputShape),
+                                   buffer.data(), paddedShape, getDenseStrides(paddedShape));
+
+    for (size_t i = 0; i + 1 < axes.size(); i++) {
+        fftAlongAxis(buffer.data(), complexShape, axes[i], getFFTPlan(complexShape[axes[i]]), true);
+    }
+    irfftAlongAxis(buffer.data(), output, outputShape, lastAxis, getRealFFTPlan(outputShape[lastAxis]));
+}
+
+const FFTPlan& RDFT::getFFTPlan(size_t length) {
+    auto& plan = fftPlans[length];
+    if (!plan)
+        plan = std::make_shared<FFTPlan>(length);
+    return *plan;
+}
+
+const RealFFTPlan& RDFT::getRealFFTPlan(size_t length) {
+    auto& plan = realFftPlans[length];
+    if (!plan)
+        plan = std::make_shared<RealFFTPlan>(length);
+    return *plan;
+}
+
+bool RDFT::created() const {
+    return getType() == Type::RDFT;
+}
+
+void RDFT::createPrimitive() {}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
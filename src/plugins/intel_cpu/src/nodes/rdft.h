@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <memory>
+#include <string>
+#include "common/fft.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class RDFT : public Node {
+public:
+    RDFT(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache);
+    ~RDFT() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    void rdftNd(const float* input, float* output);
+    void irdftNd(const float* input, float* output);
+
+    const FFTPlan& getFFTPlan(size_t length);
+    const RealFFTPlan& getRealFFTPlan(size_t length);
+
+    std::unordered_map<size_t, std::shared_ptr<FFTPlan>> fftPlans;
+    std::unordered_map<size_t, std::shared_ptr<RealFFTPlan>> realFftPlans;
+    // the input padded to the signal sizes
+    std::vector<float> buffer;
+    std::vector<int32_t> axes;
+    std::vector<int32_t> signalSizes;
+    std::vector<size_t> outputShape;
+    std::vector<size_t> inputShape;
+    std::string layerErrorPrefix;
+    const size_t DATA_INDEX = 0;
+    const size_t AXES_INDEX = 1;
+    const size_t SIGNAL_SIZE_INDEX = 2;
+    bool inverse;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
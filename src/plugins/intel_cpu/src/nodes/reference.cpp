@@ -4,10 +4,18 @@
 
 #include "reference.h"
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include <dnnl_extension_utils.h>
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/op/util/binary_elementwise_comparison.hpp"
+#include "openvino/op/util/binary_elementwise_logical.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "common/blocked_desc_creator.h"
+#include "utils/general_utils.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <algorithm>
+#include <limits>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -16,10 +24,25 @@ using namespace InferenceEngine::details;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+bool isElementwiseOp(const std::shared_ptr<ngraph::Node>& op) {
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(op) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(op) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(op) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(op) ||
+           ov::is_type<ngraph::opset1::LogicalNot>(op) ||
+           ov::is_type<ngraph::opset1::Convert>(op);
+}
+
+// the smaller tensors are evaluated by one thread, the threading overhead is higher than the evaluation
+constexpr size_t parallelEvaluationThreshold = 32 * 1024;
+
+}   // namespace
 
 Reference::Reference(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache,
                                          const std::string& errorMessage) :
-        Node(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage) {
+        Node(op, eng, cache), ngraphOp(op), additionalErrorMessage(errorMessage), isElementwise(isElementwiseOp(op)) {
     if (!op->has_evaluate()) {
         IE_THROW(NotImplemented) << "Cannot fallback on ngraph reference implementation (Ngraph::Node::evaluate() is not implemented)";
     }
@@ -57,40 +80,170 @@ void Reference::initSupportedPrimitiveDescriptors() {
 
 void Reference::createPrimitive() {}
 
+bool Reference::updateTensors(ov::TensorVector& tensors, size_t port, const MemoryPtr& mem, const ov::element::Type& type) const {
+    auto& tensor = tensors[port];
+    const auto& dims = mem->getStaticDims();
+    if (tensor && tensor.data() == mem->GetPtr() && tensor.get_shape() == dims)
+        return false;
+    tensor = ov::Tensor(type, dims, mem->GetPtr());
+    return true;
+}
+
 void Reference::execute(mkldnn::stream strm) {
-    ov::TensorVector inputs;
+    bool tensorsUpdated = false;
+    inputs.resize(inputShapes.size());
     for (size_t i = 0; i < inputShapes.size(); i++) {
-        void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
-        inputs.push_back(ov::Tensor(ngraphOp->get_input_element_type(i),
-                                             getParentEdgesAtPort(i)[0]->getMemory().getStaticDims(), srcDataPtr));
+        tensorsUpdated |= updateTensors(inputs, i, getParentEdgesAtPort(i)[0]->getMemoryPtr(), ngraphOp->get_input_element_type(i));
     }
-
-    ov::TensorVector outputs;
+    outputs.resize(outputShapes.size());
     for (size_t i = 0; i < outputShapes.size(); i++) {
-        void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
-        outputs.push_back(ov::Tensor(ngraphOp->get_output_element_type(i),
-                                              getChildEdgesAtPort(i)[0]->getMemory().getStaticDims(), dstDataPtr));
+        tensorsUpdated |= updateTensors(outputs, i, getChildEdgesAtPort(i)[0]->getMemoryPtr(), ngraphOp->get_output_element_type(i));
     }
 
-    if (!ngraphOp->evaluate(outputs, inputs)) {
+    if (tensorsUpdated) {
+        splitEvaluation = canBeSplit();
+        partOps.clear();
+    }
+
+    if (splitEvaluation) {
+        executeParallel();
+    } else {
+        evaluate(ngraphOp, outputs, inputs);
+    }
+}
+
+void Reference::evaluate(const std::shared_ptr<ngraph::Node>& op, ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    if (!op->evaluate(outputs, inputs)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
 }
 
+/*
+    The elementwise op with the same shapes of all the inputs and the outputs doesn't depend on the positions of
+    the elements, so the flattened tensors are split into the parts evaluated independently
+*/
+bool Reference::canBeSplit() const {
+    if (!isElementwise || parallel_get_max_threads() == 1)
+        return false;
+
+    const auto shape = outputs[0].get_shape();
+    if (ov::shape_size(shape) < parallelEvaluationThreshold)
+        return false;
+
+    auto sameShapeAndByteAligned = [&](const ov::TensorVector& tensors) {
+        return std::all_of(tensors.begin(), tensors.end(), [&](const ov::Tensor& tensor) {
+            return tensor.get_shape() == shape && tensor.get_element_type().bitwidth() % 8 == 0;
+        });
+    };
+    return sameShapeAndByteAligned(inputs) && sameShapeAndByteAligned(outputs);
+}
+
+void Reference::executeParallel() {
+    const size_t size = ov::shape_size(outputs[0].get_shape());
+    const size_t partSize = div_up(size, static_cast<size_t>(parallel_get_max_threads()));
+    const size_t partsNum = div_up(size, partSize);
+
+    // the evaluate() of the op uses the shapes of the op, so every part size has its own clone of the op
+    for (size_t part : {partSize, size - (partsNum - 1) * partSize}) {
+        if (partOps.count(part))
+            continue;
+        ov::OutputVector partInputs;
+        for (const auto& input : inputs) {
+            partInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), ov::Shape{part}));
+        }
+        partOps[part] = ngraphOp->clone_with_new_inputs(partInputs);
+    }
+
+    auto getPart = [](const ov::Tensor& tensor, size_t start, size_t part) {
+        const auto& type = tensor.get_element_type();
+        return ov::Tensor(type, ov::Shape{part}, static_cast<uint8_t*>(tensor.data()) + start * type.size());
+    };
+
+    parallel_for(partsNum, [&](size_t i) {
+        const size_t start = i * partSize;
+        const size_t part = std::min(partSize, size - start);
+        ov::TensorVector partInputs, partOutputs;
+        for (const auto& input : inputs)
+            partInputs.push_back(getPart(input, start, part));
+        for (const auto& output : outputs)
+            partOutputs.push_back(getPart(output, start, part));
+        evaluate(partOps.at(part), partOutputs, partInputs);
+    });
+}
+
+/*
+    The output shapes depend on the values of the input port if the op can't infer them without the values of the port.
+    The ports are probed by the shape inference of the op itself: every port in turn is replaced by Parameter,
+    while the other ports are replaced by Constant with the current values.
+    The op may reject the non-constant inputs, such a port is value dependent too
+*/
+uint32_t Reference::getValueDependentPorts() const {
+    const size_t inputsNum = ngraphOp->get_input_size();
+    ov::OutputVector parameters, constants;
+    for (size_t i = 0; i < inputsNum; i++) {
+        const auto& mem = getParentEdgesAtPort(i)[0]->getMemory();
+        const auto& rank = ngraphOp->get_input_partial_shape(i).rank();
+        const auto shape = rank.is_static() && rank.get_length() == 0 ? ov::Shape{} : ov::Shape(mem.getStaticDims());
+        const auto& type = ngraphOp->get_input_element_type(i);
+        parameters.push_back(std::make_shared<ngraph::opset1::Parameter>(type, shape));
+        constants.push_back(std::make_shared<ngraph::opset1::Constant>(type, shape, mem.GetPtr()));
+    }
+
+    auto hasStaticOutputs = [](const std::shared_ptr<ngraph::Node>& op) {
+        const auto& outputs = op->outputs();
+        return std::all_of(outputs.begin(), outputs.end(), [](const ov::Output<ngraph::Node>& output) {
+            return output.get_partial_shape().is_static();
+        });
+    };
+
+    // the port mask of the shape inference covers 32 ports
+    const size_t portsNum = std::min<size_t>(inputsNum, 32);
+    try {
+        if (hasStaticOutputs(ngraphOp->clone_with_new_inputs(parameters)))
+            return 0;
+    } catch (...) {
+        // the op can't be probed port by port, so all the ports are value dependent
+        return portsNum == 32 ? std::numeric_limits<uint32_t>::max() : (1u << portsNum) - 1;
+    }
+
+    uint32_t ports = 0;
+    for (size_t i = 0; i < portsNum; i++) {
+        auto probeInputs = constants;
+        probeInputs[i] = parameters[i];
+        bool valueDependent = true;
+        try {
+            valueDependent = !hasStaticOutputs(ngraphOp->clone_with_new_inputs(probeInputs));
+        } catch (...) {
+            // the op rejects the non-constant port
+        }
+        if (valueDependent)
+            ports |= 1u << i;
+    }
+    return ports;
+}
+
 std::vector<VectorDims> Reference::shapeInfer() const {
-    return Node::shapeInferGeneric(0xFFFFFFFF);
+    if (shapeDependency == ShapeDependency::Unknown) {
+        valueDependentPorts = getValueDependentPorts();
+        shapeDependency = valueDependentPorts ? ShapeDependency::Values : ShapeDependency::Shapes;
+    }
+    return Node::shapeInferGeneric(valueDependentPorts);
 }
 
 void Reference::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+std::string Reference::getOpType() const {
+    return ngraphOp->get_type_name();
+}
+
 bool Reference::created() const {
     return getType() == Type::Reference;
 }
 
 bool Reference::needShapeInfer() const {
-    return true;
+    return shapeDependency != ShapeDependency::Shapes || inputShapesModified();
 }
 
 }   // namespace node
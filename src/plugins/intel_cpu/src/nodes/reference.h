@@ -5,6 +5,7 @@
 #pragma once
 
 #include <node.h>
+#include "openvino/runtime/tensor.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -25,9 +26,46 @@ public:
     bool needPrepareParams() const override { return false; }
     void executeDynamicImpl(mkldnn::stream strm) override;
 
+    /**
+     * @brief Type of the operation evaluated by the ngraph reference implementation
+     */
+    std::string getOpType() const;
+
+    /**
+     * @brief Why the native nodes rejected the operation, empty if there is no native node for the operation type
+     */
+    const std::string& getFallbackReason() const {
+        return additionalErrorMessage;
+    }
+
 private:
+    enum class ShapeDependency {
+        Unknown,
+        // the output shapes depend on the input shapes only
+        Shapes,
+        // the output shapes depend on the input values
+        Values,
+    };
+
+    uint32_t getValueDependentPorts() const;
+    bool updateTensors(ov::TensorVector& tensors, size_t port, const MemoryPtr& mem, const ov::element::Type& type) const;
+    bool canBeSplit() const;
+    void evaluate(const std::shared_ptr<ngraph::Node>& op, ov::TensorVector& outputs, const ov::TensorVector& inputs) const;
+    void executeParallel();
+
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+    const bool isElementwise;
+    mutable ShapeDependency shapeDependency = ShapeDependency::Unknown;
+    // the mask of the input ports whose values are used by the shape inference
+    mutable uint32_t valueDependentPorts = 0;
+    // the tensors wrapping the edges memory are recreated only when the memory is reallocated or reshaped
+    ov::TensorVector inputs;
+    ov::TensorVector outputs;
+    // the elementwise op is evaluated on the parts of the flattened tensors in parallel by the clones of the op
+    // having the shapes of the parts, the key is the number of the elements of the part
+    bool splitEvaluation = false;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> partOps;
 };
 
 }   // namespace node
@@ -83,6 +83,7 @@
 #include <transformations/utils/utils.hpp>
 #include <snippets/pass/collapse_subgraph.hpp>
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
+#include "ngraph_transformations/mark_weights_decompression.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -173,7 +174,8 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool isLegacyApi,
+                                               const bool _enableWeightsDecompression) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -192,6 +194,12 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             defaultPrecisions = ngraph::pass::low_precision::precision_set::int8_int16_int32_support;
         }
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(defaultPrecisions);
+    } else {
+        // int8 weights of MatMul are kept compressed and decompressed by FullyConnected on the fly
+        if (_enableWeightsDecompression)
+            manager.register_pass<MarkWeightsDecompression>();
+        // int8 embedding tables are kept compressed and dequantized row by row by the embedding nodes
+        manager.register_pass<MarkEmbeddingTableDecompression>();
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -424,6 +432,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([&defaultPrecisions](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node, defaultPrecisions);
         });
+    } else {
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            return isWeightsDecompressionEltwise(node);
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -544,9 +556,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi,
+                           const bool _enableWeightsDecompression) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi, _enableWeightsDecompression);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -678,8 +691,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& weightsDecompressionProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION);
+    const bool enableWeightsDecompression = weightsDecompressionProp != config.end()
+            ? weightsDecompressionProp->second == PluginConfigParams::YES /* set in the orig_config */
+            : engConfig.weightsDecompression /* or the plugin setting */;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI(), enableWeightsDecompression);
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -918,7 +935,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI(), conf.weightsDecompression);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -994,6 +1011,13 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
+    // the blobs exported before the compiled constants were introduced end right after the network
+    CompiledConstants::CPtr compiledConstants;
+    if (deserializer.hasCompiledConstants()) {
+        CompiledConstantsDeserializer constantsDeserializer(networkModel);
+        constantsDeserializer >> compiledConstants;
+    }
+
     Config conf = engConfig;
     conf.readProperties(config);
 
@@ -1001,7 +1025,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing, shared_from_this(),
+                                                     compiledConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -2,11 +2,18 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "serialize.h"
+#include "graph.h"
+#include "edge.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 
 #include <openvino/pass/serialize.hpp>
 
 #include <pugixml.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 using namespace InferenceEngine;
 
 namespace ov {
@@ -65,6 +72,71 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    /*
+        Compiled constants section format, all the numbers are uint64_t:
+        [ magic ][ entries count ]
+        [ entry: name, precision name, dims, block dims, order, offset padding to data, strides, offset padding, data ]
+        The strings, vectors and data are prefixed with their size, so the section is read sequentially.
+    */
+    constexpr uint64_t compiledConstantsMagic = 0x5354534E4F435043;  // "CPCONSTS"
+    constexpr uint64_t maxDimsCount = 12;  // DNNL_MAX_NDIMS
+    // the sizes are read from the stream, so the buffers grow by chunks as the data is actually read and a
+    // corrupted size can't cause a huge allocation
+    constexpr uint64_t readChunkSize = 1 << 20;
+
+    void write(std::ostream & stream, uint64_t value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void write(std::ostream & stream, const std::string & str) {
+        write(stream, str.size());
+        stream.write(str.c_str(), str.size());
+    }
+
+    void write(std::ostream & stream, const VectorDims & dims) {
+        write(stream, dims.size());
+        for (auto dim : dims)
+            write(stream, dim);
+    }
+
+    uint64_t readValue(std::istream & stream) {
+        uint64_t value = 0;
+        stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+        if (!stream)
+            IE_THROW(NetworkNotRead) << "The compiled constants section is truncated.";
+        return value;
+    }
+
+    template<typename Container>
+    void readData(std::istream & stream, Container & data) {
+        const uint64_t size = readValue(stream);
+        data.clear();
+        for (uint64_t pos = 0; pos < size;) {
+            const uint64_t chunk = std::min(size - pos, readChunkSize);
+            data.resize(pos + chunk);
+            stream.read(reinterpret_cast<char*>(&data[pos]), chunk);
+            if (!stream)
+                IE_THROW(NetworkNotRead) << "The compiled constants section is truncated.";
+            pos += chunk;
+        }
+    }
+
+    VectorDims readDims(std::istream & stream) {
+        const uint64_t count = readValue(stream);
+        if (count > maxDimsCount)
+            IE_THROW(NetworkNotRead) << "The compiled constants information is invalid.";
+        VectorDims dims(count);
+        for (auto & dim : dims)
+            dim = readValue(stream);
+        return dims;
+    }
+
+    bool isConstOutput(const EdgePtr & edge) {
+        auto parent = edge->getParent();
+        // the Input constants are restored from the network weights
+        return parent->isConstant() && parent->getType() != Type::Input && !edge->getChild()->isConstant();
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -91,6 +163,8 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         const std::string name = "cnndata";
         pugi::xml_document xml_doc;
         pugi::xml_node root = xml_doc.append_child(name.c_str());
+        // the compiled constants section is written by ExecNetwork::Export right after the network
+        root.append_attribute("compiled_constants").set_value(true);
         pugi::xml_node inputs = root.append_child("inputs");
         pugi::xml_node outputs = root.append_child("outputs");
 
@@ -167,6 +241,7 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     // Set input and output precisions
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
+    _hasCompiledConstants = root.attribute("compiled_constants").as_bool(false);
     pugi::xml_node inputs = root.child("inputs");
     pugi::xml_node outputs = root.child("outputs");
 
@@ -174,5 +249,107 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+bool CompiledConstants::restore(const EdgePtr & edge) const {
+    auto it = entries.find(edge->name());
+    if (it == entries.end())
+        return false;
+
+    const auto & memory = edge->getMemory();
+    const auto & entry = it->second;
+    if (!memory.isAllocated() || !memory.getDesc().isCompatible(*entry.desc) || memory.GetSize() != entry.data.size())
+        return false;
+
+    std::memcpy(memory.GetData(), entry.data.data(), entry.data.size());
+    return true;
+}
+
+CompiledConstantsSerializer::CompiledConstantsSerializer(std::ostream & ostream)
+    : _ostream(ostream) {
+}
+
+void CompiledConstantsSerializer::operator << (Graph & graph) {
+    std::vector<std::pair<EdgePtr, CpuBlockedMemoryDesc>> edges;
+    for (const auto & edge : graph.GetEdges()) {
+        if (!isConstOutput(edge) || !edge->getMemory().isAllocated())
+            continue;
+        const auto & memDesc = edge->getMemory().getDesc();
+        if (!memDesc.isDefined() || !(memDesc.getType() & MemoryDescType::Blocked))
+            continue;
+
+        // the descriptor is stored by its blocked layout fields, the layouts which can't be described this way
+        // (e.g. the compensated int8 weights) are not stored and the constant subgraph is executed on import
+        const auto & blockedDesc = memDesc.as<BlockedMemoryDesc>();
+        CpuBlockedMemoryDesc desc(blockedDesc.getPrecision(), blockedDesc.getShape(), blockedDesc.getBlockDims(),
+                                  blockedDesc.getOrder(), blockedDesc.getOffsetPadding(),
+                                  blockedDesc.getOffsetPaddingToData(), blockedDesc.getStrides());
+        if (memDesc.isCompatible(desc) && desc.getCurrentMemSize() == edge->getMemory().GetSize())
+            edges.emplace_back(edge, std::move(desc));
+    }
+
+    write(_ostream, compiledConstantsMagic);
+    write(_ostream, edges.size());
+    for (const auto & item : edges) {
+        const auto & memory = item.first->getMemory();
+        const auto & desc = item.second;
+        write(_ostream, item.first->name());
+        write(_ostream, std::string(desc.getPrecision().name()));
+        write(_ostream, desc.getShape().getStaticDims());
+        write(_ostream, desc.getBlockDims());
+        write(_ostream, desc.getOrder());
+        write(_ostream, desc.getOffsetPaddingToData());
+        write(_ostream, desc.getStrides());
+        write(_ostream, desc.getOffsetPadding());
+        write(_ostream, memory.GetSize());
+        _ostream.write(static_cast<const char*>(memory.GetData()), memory.GetSize());
+    }
+}
+
+CompiledConstantsDeserializer::CompiledConstantsDeserializer(std::istream & istream)
+    : _istream(istream) {
+}
+
+void CompiledConstantsDeserializer::operator >> (CompiledConstants::CPtr & constants) {
+    constants.reset();
+
+    if (readValue(_istream) != compiledConstantsMagic) {
+        IE_THROW(NetworkNotRead) << "The compiled constants section is invalid.";
+    }
+
+    auto result = std::make_shared<CompiledConstants>();
+    const uint64_t count = readValue(_istream);
+    // the count isn't used to reserve anything, a corrupted one fails on the first missing entry
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name, precisionName;
+        readData(_istream, name);
+        readData(_istream, precisionName);
+        const auto precision = Precision::FromStr(precisionName);
+        if (precision == Precision::UNSPECIFIED) {
+            IE_THROW(NetworkNotRead) << "Unknown precision with name '" << precisionName << "'";
+        }
+
+        const auto dims = readDims(_istream);
+        const auto blockDims = readDims(_istream);
+        const auto order = readDims(_istream);
+        const auto offsetPaddingToData = readDims(_istream);
+        const auto strides = readDims(_istream);
+        const auto offsetPadding = readValue(_istream);
+
+        CompiledConstants::Entry entry;
+        try {
+            entry.desc = std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(dims), blockDims, order,
+                                                                offsetPadding, offsetPaddingToData, strides);
+        } catch (const std::exception & e) {
+            IE_THROW(NetworkNotRead) << "The compiled constants information is invalid: " << e.what();
+        }
+        readData(_istream, entry.data);
+        if (entry.data.size() != entry.desc->getCurrentMemSize()) {
+            IE_THROW(NetworkNotRead) << "The compiled constants information is invalid.";
+        }
+        result->entries.emplace(std::move(name), std::move(entry));
+    }
+
+    constants = result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -6,7 +6,12 @@
 
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <cpp/ie_cnn_network.h>
+#include "memory_desc/cpu_memory_desc.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -30,9 +35,63 @@ public:
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
+    // the compiled constants section follows the network in the blobs exported by the current plugin version
+    bool hasCompiledConstants() const {
+        return _hasCompiledConstants;
+    }
+
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    bool _hasCompiledConstants = false;
+};
+
+class Graph;
+class Edge;
+using EdgePtr = std::shared_ptr<Edge>;
+
+/**
+ * @brief Contents of the constant edges (folded and reordered weights) of a compiled graph.
+ * Allows to avoid execution of the constant subgraphs when the same network is imported.
+ */
+class CompiledConstants {
+public:
+    typedef std::shared_ptr<const CompiledConstants> CPtr;
+
+    struct Entry {
+        MemoryDescPtr desc;
+        std::vector<uint8_t> data;
+    };
+
+    /**
+     * @brief Copies the stored data into the edge memory
+     * @return false if the edge data was not stored or the stored descriptor is not compatible with the edge one
+     */
+    bool restore(const EdgePtr& edge) const;
+
+private:
+    std::unordered_map<std::string, Entry> entries;
+
+    friend class CompiledConstantsDeserializer;
+};
+
+class CompiledConstantsSerializer {
+public:
+    explicit CompiledConstantsSerializer(std::ostream & ostream);
+    void operator << (Graph & graph);
+
+private:
+    std::ostream & _ostream;
+};
+
+class CompiledConstantsDeserializer {
+public:
+    explicit CompiledConstantsDeserializer(std::istream & istream);
+    // the section is read sequentially, so the stream doesn't have to be seekable
+    void operator >> (CompiledConstants::CPtr & constants);
+
+private:
+    std::istream & _istream;
 };
 
 // const std::string& model, const Blob::CPtr& weights
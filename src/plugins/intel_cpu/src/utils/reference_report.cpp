@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#ifdef CPU_DEBUG_CAPS
+
+#include "reference_report.h"
+#include "graph.h"
+#include "nodes/reference.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+void printReferenceReport(Graph& graph) {
+    if (graph.getConfig().referenceReport.empty() || !graph.IsReady())
+        return;
+
+    struct OpTypeInfo {
+        std::vector<node::Reference*> nodes;
+        uint64_t time = 0;
+    };
+    std::map<std::string, OpTypeInfo> fallbacks;
+    uint64_t graphTime = 0;
+    size_t executableNodes = 0;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->isConstant() || node->getType() == Type::Input || node->getType() == Type::Output)
+            continue;
+        executableNodes++;
+        graphTime += node->PerfCounter().avg();
+        if (auto reference = dynamic_cast<node::Reference*>(node.get())) {
+            auto& info = fallbacks[reference->getOpType()];
+            info.nodes.push_back(reference);
+            info.time += node->PerfCounter().avg();
+        }
+    }
+
+    std::stringstream stream;
+    stream << "ov_cpu_reference_report," << graph.GetName() << ": " << fallbacks.size() << " op types, ";
+    size_t fallbackNodes = 0;
+    for (const auto& fallback : fallbacks)
+        fallbackNodes += fallback.second.nodes.size();
+    stream << fallbackNodes << " of " << executableNodes << " executable nodes fall back to the reference implementation\n";
+
+    for (const auto& fallback : fallbacks) {
+        const auto& info = fallback.second;
+        stream << "    " << fallback.first << " x" << info.nodes.size();
+        if (graphTime != 0) {
+            stream << ", " << info.time << " us per inference ("
+                   << std::fixed << std::setprecision(1) << 100.0 * info.time / graphTime << "% of the graph)";
+        }
+        stream << "\n";
+        for (const auto& node : info.nodes) {
+            std::string reason = node->getFallbackReason();
+            std::replace(reason.begin(), reason.end(), '\n', ' ');
+            stream << "        " << node->getName() << ": " << (reason.empty() ? "no native node for the op type" : reason) << "\n";
+        }
+    }
+    std::cout << stream.rdbuf();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#endif // CPU_DEBUG_CAPS
@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#ifdef CPU_DEBUG_CAPS
+
+namespace ov {
+namespace intel_cpu {
+
+class Graph;
+
+/**
+ * @brief Prints the operations of the graph evaluated by the ngraph reference implementations instead of the native
+ * nodes, grouped by the operation type, with the reasons of the fallback. The average execution time of the fallback
+ * nodes and their share of the graph execution time are printed if the graph has been executed.
+ */
+void printReferenceReport(Graph& graph);
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#endif // CPU_DEBUG_CAPS
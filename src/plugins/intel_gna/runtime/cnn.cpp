@@ -6,7 +6,9 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
 #include "backend/dnn_types.h"
@@ -37,15 +39,27 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+    // the filters are transposed to [filterSize][numberOfFilters], so the outputs of all the filters are accumulated
+    // together in the contiguous inner loop, each output still sums its products in the original order
+    std::vector<float> transposedFilters(static_cast<size_t>(filterSize) * numberOfFilters);
+    for (uint32_t i = 0; i < numberOfFilters; i++) {
+        for (uint32_t k = 0; k < filterSize; k++) {
+            transposedFilters[k * numberOfFilters + i] = filters[i * filterSize + k];
         }
     }
+
+    InferenceEngine::parallel_for(numberOfOutputsPerFilter, [&](uint32_t j) {
+        const float* in = input + j * convolutionStride;
+        float* out = output + j * numberOfFilters;
+        std::copy(biases, biases + numberOfFilters, out);
+        for (uint32_t k = 0; k < filterSize; k++) {
+            const float inputElement = in[k];
+            const float* filter = transposedFilters.data() + k * numberOfFilters;
+            for (uint32_t i = 0; i < numberOfFilters; i++) {
+                out[i] += inputElement * filter[i];
+            }
+        }
+    });
 }
 
 namespace {
@@ -188,49 +202,24 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
 
 namespace {
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
+void checkPaddedArea(unsigned filterSize, unsigned outputSize, unsigned inputSize, unsigned paddingSize, unsigned stride) {
+    if (filterSize == 0 || outputSize == 0) {
+        return;
+    }
+    // the last filter element applied to the last output
+    const auto paddedIndex = stride * (outputSize - 1) + filterSize - 1;
     if (paddedIndex >= inputSize + 2 * paddingSize) {
         THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
     }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
 }
 
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
+// the range [begin, end) of the filter elements which are applied to the input and not to the zero padding
+void filterRangeOutsidePadding(unsigned outputIndex, unsigned filterSize, unsigned inputSize, unsigned paddingSize,
+                               unsigned stride, unsigned& begin, unsigned& end) {
+    const auto first = stride * outputIndex;
+    begin = first < paddingSize ? std::min(filterSize, paddingSize - first) : 0;
+    end = first < inputSize + paddingSize ? std::min(filterSize, inputSize + paddingSize - first) : 0;
+    end = std::max(begin, end);
 }
 
 } // namespace
@@ -263,21 +252,55 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if (kc != 0) {
+        checkPaddedArea(kh, OH, IH, zPH, cSH);
+        checkPaddedArea(kw, OW, IW, zPW, cSW);
+    }
+
+    // the kernels are padded to 16B = 4 * sizeof(float), they are repacked to [kh][kw][kc][oc]
+    // so that all the output channels of the output pixel are accumulated in the contiguous inner loop
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    const size_t kernelSize = static_cast<size_t>(kh) * kw * kc;
+    std::vector<float> packedFilters(kernelSize * OC);
     for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
-            }
+        for (size_t k = 0; k < kernelSize; k++) {
+            packedFilters[k * OC + oc] = ptr_filters[oc * kernelStride + k];
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
     }
+
+    // every output pixel sums its products in the same (kh, kw, kc) order and adds the bias last
+    InferenceEngine::parallel_for(OH * OW, [&](size_t pixel) {
+        const unsigned oh = static_cast<unsigned>(pixel / OW);
+        const unsigned ow = static_cast<unsigned>(pixel % OW);
+        float* output = ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC);
+        std::fill(output, output + OC, 0.0f);
+
+        unsigned khBegin, khEnd, kwBegin, kwEnd;
+        filterRangeOutsidePadding(oh, kh, IH, zPH, cSH, khBegin, khEnd);
+        filterRangeOutsidePadding(ow, kw, IW, zPW, cSW, kwBegin, kwEnd);
+        for (unsigned fh = khBegin; fh < khEnd; fh++) {
+            for (unsigned fw = kwBegin; fw < kwEnd; fw++) {
+                const auto ih = (cSH * oh + fh) - zPH;
+                const auto iw = (cSW * ow + fw) - zPW;
+                const float* image = ptr_inputs + getQubeIndex(ih, iw, 0u, IW, IC);
+                const float* filter = packedFilters.data() + static_cast<size_t>(getQubeIndex(fh, fw, 0u, kw, kc)) * OC;
+                for (unsigned fc = 0; fc < kc; fc++, filter += OC) {
+                    const float imageElement = image[fc];
+                    for (unsigned oc = 0; oc < OC; oc++) {
+                        output[oc] += imageElement * filter[oc];
+                    }
+                }
+            }
+        }
+        for (unsigned oc = 0; oc < OC; oc++) {
+            output[oc] += ptr_biases[oc];
+        }
+    });
 }
 
 namespace {
@@ -1,14 +1,60 @@
 // Copyright (C) 2018-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software float runtime (for reference)
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 
+#include <ie_parallel.hpp>
+
 #include "floatmath.h"
 
+namespace {
+// the minimal number of multiply-adds processed by a single parallel task
+constexpr size_t kMinTaskWork = 1 << 14;
+// the number of output columns which are accumulated together, keeps the block of the output row in L1
+constexpr int kColumnsBlock = 256;
+
+// runs body(first_row, last_row) over the blocks of rows, the blocks are processed in parallel
+// only if the rows carry enough work to pay off the threading overhead
+template <typename F>
+void ParallelRows(size_t num_rows, size_t work_per_row, const F& body) {
+    const size_t num_threads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t min_rows = std::max<size_t>(1, kMinTaskWork / std::max<size_t>(1, work_per_row));
+    const size_t rows_per_task = std::max(min_rows, (num_rows + 4 * num_threads - 1) / (4 * num_threads));
+    const size_t num_tasks = (num_rows + rows_per_task - 1) / rows_per_task;
+    if (num_tasks <= 1) {
+        body(0, num_rows);
+        return;
+    }
+    InferenceEngine::parallel_for(num_tasks, [&](size_t task) {
+        body(task * rows_per_task, std::min(num_rows, (task + 1) * rows_per_task));
+    });
+}
+
+// c_row[j] (+)= sum(a_row[k] * B[k][j]), the products are accumulated in the ascending k order like in the
+// reference dot product, the inner loop runs over the contiguous columns so it is vectorized by the compiler
+void SgemmRow(const float *a_row, const float *B, const int ldb, const int N, const int K,
+              const bool accumulate, float *c_row) {
+    if (!accumulate) {
+        std::fill(c_row, c_row + N, 0.0f);
+    }
+    for (int j0 = 0; j0 < N; j0 += kColumnsBlock) {
+        const int j1 = std::min(N, j0 + kColumnsBlock);
+        for (int k = 0; k < K; k++) {
+            const float a = a_row[k];
+            const float *b_row = B + k * ldb;
+            for (int j = j0; j < j1; j++) {
+                c_row[j] += a * b_row[j];
+            }
+        }
+    }
+}
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -27,15 +73,11 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+        ParallelRows(M, static_cast<size_t>(N) * K, [&](size_t first_row, size_t last_row) {
+            for (size_t row = first_row; row < last_row; row++) {
+                SgemmRow(A + row * lda, B, ldb, N, K, beta == 1.0, C + row * ldc);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +147,11 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+        ParallelRows(L, static_cast<size_t>(N) * K, [&](size_t first_row, size_t last_row) {
+            for (size_t row = first_row; row < last_row; row++) {
+                SgemmRow(A + OutputList[row] * lda, B, ldb, N, K, beta == 1.0, C + row * ldc);
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -155,18 +192,19 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    ParallelRows(num_rows, num_columns, [&](size_t first_row, size_t last_row) {
+        for (size_t i = first_row; i < last_row; i++) {
+            float sum = B[i];
+            for (uint32_t j = 0; j < K1; j++) {
+                sum += A1[j] * X[i * num_columns + j];
+            }
+            for (uint32_t j = K1; j < num_columns; j++) {
+                sum += A2[j - K1] * X[i * num_columns + j];
+            }
+            C[i] = sum;
         }
-        C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
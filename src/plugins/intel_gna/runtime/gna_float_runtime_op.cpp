@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <ie_parallel.hpp>
+
 #include "gna_float_runtime.hpp"
 #include "pwl.h"
 #include "cnn.h"
@@ -74,18 +76,16 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    for (uint32_t i = 0; i < m; i++) {
-        for (uint32_t j = 0; j < n; j++) {
-            C[i * ldc + j] = bias[i];
-        }
-    }
-    std::vector<float> Arow(n);
-    for (uint32_t i = 0; i < m; i++) {
-        float *Brow = B + i * n;
+    // every row is scaled by its own diagonal element, the rows are independent and are processed in parallel
+    InferenceEngine::parallel_for(m, [&](int i) {
+        const float *Brow = B + i * n;
         float *Crow = C + i * ldc;
-        std::fill(std::begin(Arow), std::end(Arow), A[i]);
-        cblas_ssbmv1(CblasRowMajor, CblasLower, n, 0, 1.0, Arow.data(), 1, Brow, 1, 1.0, Crow, 1);
-    }
+        const float a = A[i];
+        for (int j = 0; j < n; j++) {
+            Crow[j] = bias[i];
+            Crow[j] += a * Brow[j];
+        }
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -28,6 +28,7 @@
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
+#include <ie_parallel.hpp>
 
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 inline double first_deriv_exp(const double x) { return(exp(x)); }
@@ -857,11 +858,16 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+// the minimal number of elements processed by a single parallel task, the activation functions are computed exactly
+// (libm), so even the small layers pay off the threading overhead
+constexpr size_t kPwlMinElementsPerTask = 2048;
+
+void PwlApply32Range(intel_dnn_component_t *component,
+                     uint32_t num_row_start,
+                     uint32_t num_row_end,
+                     uint32_t num_col_start,
+                     uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1008,3 +1014,36 @@ void PwlApply32(intel_dnn_component_t *component,
             THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    if (num_row_end < num_row_start || num_col_end < num_col_start) {
+        PwlApply32Range(component, num_row_start, num_row_end, num_col_start, num_col_end);
+        return;
+    }
+    // the elements are independent, the range is split into the blocks of rows,
+    // or into the blocks of columns if there are not enough rows to keep all the threads busy
+    const size_t num_rows = static_cast<size_t>(num_row_end - num_row_start) + 1;
+    const size_t num_cols = static_cast<size_t>(num_col_end - num_col_start) + 1;
+    const size_t num_tasks = std::min(static_cast<size_t>(parallel_get_max_threads()),
+                                      num_rows * num_cols / kPwlMinElementsPerTask);
+    if (num_tasks <= 1) {
+        PwlApply32Range(component, num_row_start, num_row_end, num_col_start, num_col_end);
+    } else if (num_rows >= num_tasks) {
+        InferenceEngine::parallel_for(num_tasks, [&](size_t task) {
+            const auto first = static_cast<uint32_t>(num_row_start + num_rows * task / num_tasks);
+            const auto last = static_cast<uint32_t>(num_row_start + num_rows * (task + 1) / num_tasks - 1);
+            PwlApply32Range(component, first, last, num_col_start, num_col_end);
+        });
+    } else {
+        InferenceEngine::parallel_for(num_tasks, [&](size_t task) {
+            const auto first = static_cast<uint32_t>(num_col_start + num_cols * task / num_tasks);
+            const auto last = static_cast<uint32_t>(num_col_start + num_cols * (task + 1) / num_tasks - 1);
+            PwlApply32Range(component, num_row_start, num_row_end, first, last);
+        });
+    }
+}
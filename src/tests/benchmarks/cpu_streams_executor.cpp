@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace InferenceEngine;
+
+// Enqueue->start latency of the small tasks submitted from several producers, every producer waits for its previous
+// task to start, so the queues are never overloaded. The producers are either the external threads or the stream
+// threads of the executor, the latter submit to the own stream queues in the work stealing mode
+TEST(CPUStreamsExecutorBenchmark, enqueueToStartLatency) {
+    using Clock = std::chrono::steady_clock;
+    const int streams = std::max(2, getNumberOfCPUCores());
+    const int producersNum = std::max(1, streams / 2);
+    const int tasksPerProducer = 20000;
+
+    auto measure = [&](bool workStealing, bool fromStreams) {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = workStealing;
+        const auto executor = std::make_shared<CPUStreamsExecutor>(config);
+        std::vector<double> latencies(producersNum * tasksPerProducer);
+        std::atomic_int finished = {0};
+        auto produce = [&](int p) {
+            std::atomic_bool started = {false};
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                started = false;
+                const auto enqueued = Clock::now();
+                auto& latency = latencies[p * tasksPerProducer + i];
+                executor->run([enqueued, &latency, &started] {
+                    latency = std::chrono::duration<double, std::micro>(Clock::now() - enqueued).count();
+                    started = true;
+                });
+                while (!started) {
+                    std::this_thread::yield();
+                }
+            }
+            ++finished;
+        };
+        std::vector<std::thread> producers;
+        for (int p = 0; p < producersNum; ++p) {
+            if (fromStreams) {
+                executor->run([&, p] {
+                    produce(p);
+                });
+            } else {
+                producers.emplace_back(produce, p);
+            }
+        }
+        for (auto&& producer : producers) {
+            producer.join();
+        }
+        while (finished != producersNum) {
+            std::this_thread::yield();
+        }
+        std::sort(latencies.begin(), latencies.end());
+        return std::make_pair(latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100]);
+    };
+
+    for (bool fromStreams : {false, true}) {
+        const auto fifo = measure(false, fromStreams);
+        const auto workStealing = measure(true, fromStreams);
+        std::cout << (fromStreams ? "stream thread producers" : "external producers") << std::endl;
+        std::cout << "  FIFO:          median " << fifo.first << " us, p99 " << fifo.second << " us" << std::endl;
+        std::cout << "  work stealing: median " << workStealing.first << " us, p99 " << workStealing.second << " us"
+                  << std::endl;
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace ngraph;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// the plain i-k-j loop the blocked reference kernel replaced
+void naive_dot(const float* arg0, const float* arg1, float* out, size_t I_dim, size_t K_dim, size_t J_dim) {
+    std::fill(out, out + I_dim * J_dim, 0.f);
+    for (size_t i = 0; i < I_dim; ++i) {
+        for (size_t k = 0; k < K_dim; ++k) {
+            for (size_t j = 0; j < J_dim; ++j) {
+                out[i * J_dim + j] += arg0[i * K_dim + k] * arg1[k * J_dim + j];
+            }
+        }
+    }
+}
+
+std::vector<float> random_vector(size_t size, std::mt19937& gen) {
+    std::uniform_int_distribution<int> dist(-8, 8);
+    std::vector<float> v(size);
+    for (auto& x : v) {
+        x = static_cast<float>(dist(gen)) / 4.f;
+    }
+    return v;
+}
+}  // namespace
+
+TEST(ReferenceKernelsBenchmark, matmul) {
+    const size_t I = 512, K = 1024, J = 1024;
+    std::mt19937 gen(0);
+    const auto a = random_vector(I * K, gen);
+    const auto b = random_vector(K * J, gen);
+    std::vector<float> expected(I * J), result(I * J);
+
+    const auto t0 = Clock::now();
+    naive_dot(a.data(), b.data(), expected.data(), I, K, J);
+    const auto t1 = Clock::now();
+    runtime::reference::matmul(a.data(), b.data(), result.data(), Shape{I, K}, Shape{K, J}, Shape{I, J}, false, false);
+    const auto t2 = Clock::now();
+
+    std::cout << "naive:     " << elapsed_ms(t0, t1) << " ms" << std::endl;
+    std::cout << "reference: " << elapsed_ms(t1, t2) << " ms" << std::endl;
+    EXPECT_EQ(expected, result);
+}
+
+// the per-call overhead of the small parallel loops, e.g. the evaluate calls of the constant folding, compared with
+// starting the threads on every call
+TEST(ReferenceKernelsBenchmark, parallel_for_chunks_overhead) {
+    const size_t calls = 2000, work_amount = 1024;
+    const size_t threads_num = std::max(2u, std::thread::hardware_concurrency());
+    std::vector<float> data(work_amount, 1.f);
+    auto body = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            data[i] *= 1.0001f;
+        }
+    };
+
+    const auto t0 = Clock::now();
+    for (size_t call = 0; call < calls; ++call) {
+        std::vector<std::thread> threads;
+        for (size_t ithr = 1; ithr < threads_num; ++ithr) {
+            threads.emplace_back(body, work_amount * ithr / threads_num, work_amount * (ithr + 1) / threads_num);
+        }
+        body(0, work_amount / threads_num);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    const auto t1 = Clock::now();
+    for (size_t call = 0; call < calls; ++call) {
+        runtime::reference::parallel_for_chunks(work_amount, 1, body, threads_num);
+    }
+    const auto t2 = Clock::now();
+
+    std::cout << "threads per call:    " << elapsed_ms(t0, t1) * 1000 / calls << " us/call" << std::endl;
+    std::cout << "parallel_for_chunks: " << elapsed_ms(t1, t2) * 1000 / calls << " us/call" << std::endl;
+}
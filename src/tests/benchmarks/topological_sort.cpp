@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+namespace {
+// replaces every n-th Relu of the model with a new one
+class ReplaceRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReplaceRelu");
+    explicit ReplaceRelu(size_t period) {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        auto counter = std::make_shared<size_t>(0);
+        ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+            if ((*counter)++ % period != 0) {
+                return false;
+            }
+            auto root = m.get_match_root();
+            ov::replace_node(root, std::make_shared<ov::opset8::Relu>(root->input_value(0)));
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "ReplaceRelu"), callback);
+    }
+};
+
+// a chain of residual blocks x = x + Relu(x * c) like in the transformer models
+std::shared_ptr<ov::Model> make_residual_model(size_t num_blocks) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    ov::Output<ov::Node> x = param;
+    for (size_t i = 0; i < num_blocks; i++) {
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 16}, std::vector<float>(16, 0.5f));
+        auto relu = std::make_shared<ov::opset8::Relu>(std::make_shared<ov::opset8::Multiply>(x, scale));
+        x = std::make_shared<ov::opset8::Add>(x, relu);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{x}, ov::ParameterVector{param});
+}
+}  // namespace
+
+// The pass pipeline on a large model with the incrementally updated topological order and with the order rebuilt
+// from scratch after every change (a custom sorter disables the updates)
+TEST(TopologicalSortBenchmark, pass_manager) {
+    const size_t num_blocks = 12500;  // 50k nodes
+    const size_t num_passes = 50;
+    auto run = [&](bool incremental, size_t& num_ops) {
+        auto model = make_residual_model(num_blocks);
+        if (!incremental) {
+            model->set_topological_sort(ov::topological_sort<std::vector<std::shared_ptr<ov::Node>>>);
+        }
+        ov::pass::Manager manager;
+        for (size_t i = 0; i < num_passes; i++) {
+            manager.register_pass<ReplaceRelu>(1000);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        manager.run_passes(model);
+        const auto end = std::chrono::steady_clock::now();
+        num_ops = model->get_ordered_ops().size();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    size_t full_num_ops = 0, incremental_num_ops = 0;
+    const double full_ms = run(false, full_num_ops);
+    const double incremental_ms = run(true, incremental_num_ops);
+    std::cout << "nodes: " << full_num_ops << ", passes: " << num_passes << ", full sort: " << full_ms
+              << " ms, incremental update: " << incremental_ms << " ms" << std::endl;
+    EXPECT_EQ(full_num_ops, incremental_num_ops);
+}
@@ -106,6 +106,26 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
     for (auto&& thread : threads) if (thread.joinable()) thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunTasksSubmittedFromTasks) {
+    auto taskExecutor = GetParam()();
+    std::atomic_int sharedVar = {0};
+    std::vector<Future> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&] {
+            ++sharedVar;
+        });
+        futures.emplace_back(p->get_future());
+        auto executor = taskExecutor.get();
+        taskExecutor->run([p, executor] {
+            executor->run([p] {(*p)();});
+        });
+    }
+
+    for (auto&& f : futures) f.wait();
+    for (auto&& f : futures) ASSERT_NO_THROW(f.get());
+    ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, sharedVar);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
@@ -208,6 +228,14 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -233,6 +261,14 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._workStealing = true;
+        return std::make_shared<CPUStreamsExecutor>(config);
     }
 );
 
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "single_layer_tests/rdft.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace LayerTestsDefinitions;
+
+const std::vector<InferenceEngine::Precision> inputPrecision = {
+    InferenceEngine::Precision::FP32
+};
+
+/* The lengths with the prime factors other than 2, 3 and 5 are transformed by the Bluestein algorithm */
+const std::vector<std::vector<size_t>> rdftShapes = {
+    {3, 11, 17},
+    {5, 6, 16},
+    {2, 7, 14},
+};
+
+/* The complex input of IRDFT, the last dimension holds the real and the imaginary parts */
+const std::vector<std::vector<size_t>> irdftShapes = {
+    {3, 11, 9, 2},
+    {4, 7, 6, 2},
+    {2, 13, 8, 2},
+};
+
+/* 1D RDFT */
+const std::vector<std::vector<int64_t>> axes1D = {
+    {0}, {1}, {2}, {-1}
+};
+
+const std::vector<std::vector<int64_t>> signalSizes1D = {
+    {}, {13}, {22}
+};
+
+/* 2D RDFT */
+const std::vector<std::vector<int64_t>> axes2D = {
+    {1, 2}, {2, 0}, {-1, -2}
+};
+
+const std::vector<std::vector<int64_t>> signalSizes2D = {
+    {}, {7, 17}, {16, 11}
+};
+
+/* 3D RDFT */
+const std::vector<std::vector<int64_t>> axes3D = {
+    {0, 1, 2}, {2, 0, 1}
+};
+
+const std::vector<std::vector<int64_t>> signalSizes3D = {
+    {}, {4, 13, 14}
+};
+
+const auto testCaseRDFT1D = ::testing::Combine(
+    ::testing::ValuesIn(rdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes1D),
+    ::testing::ValuesIn(signalSizes1D),
+    ::testing::Values(ngraph::helpers::DFTOpType::FORWARD),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCaseRDFT2D = ::testing::Combine(
+    ::testing::ValuesIn(rdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes2D),
+    ::testing::ValuesIn(signalSizes2D),
+    ::testing::Values(ngraph::helpers::DFTOpType::FORWARD),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCaseRDFT3D = ::testing::Combine(
+    ::testing::ValuesIn(rdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes3D),
+    ::testing::ValuesIn(signalSizes3D),
+    ::testing::Values(ngraph::helpers::DFTOpType::FORWARD),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCaseIRDFT1D = ::testing::Combine(
+    ::testing::ValuesIn(irdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes1D),
+    ::testing::ValuesIn(signalSizes1D),
+    ::testing::Values(ngraph::helpers::DFTOpType::INVERSE),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCaseIRDFT2D = ::testing::Combine(
+    ::testing::ValuesIn(irdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes2D),
+    ::testing::ValuesIn(signalSizes2D),
+    ::testing::Values(ngraph::helpers::DFTOpType::INVERSE),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCaseIRDFT3D = ::testing::Combine(
+    ::testing::ValuesIn(irdftShapes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::ValuesIn(axes3D),
+    ::testing::ValuesIn(signalSizes3D),
+    ::testing::Values(ngraph::helpers::DFTOpType::INVERSE),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsRDFT_1d, RDFTLayerTest, testCaseRDFT1D, RDFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsRDFT_2d, RDFTLayerTest, testCaseRDFT2D, RDFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsRDFT_3d, RDFTLayerTest, testCaseRDFT3D, RDFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsIRDFT_1d, RDFTLayerTest, testCaseIRDFT1D, RDFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsIRDFT_2d, RDFTLayerTest, testCaseIRDFT2D, RDFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_INTEL_CPU_TestsIRDFT_3d, RDFTLayerTest, testCaseIRDFT3D, RDFTLayerTest::getTestCaseName);
@@ -182,7 +182,9 @@ std::vector<ngraph::Shape> inShapesStatic = {
         { 4, 100 },
         { 4, 2, 100 },
         { 4, 4, 2, 100 },
-        { 4, 4, 4, 2, 100 }
+        { 4, 4, 4, 2, 100 },
+        // large enough to be split across the threads
+        { 1, 3, 256, 256 }
 };
 
 const auto paramsStatic = ::testing::Combine(
@@ -0,0 +1,86 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <transformations/rt_info/decompression.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      Constant (f16)
+ *                           |
+ *          Parameter     Convert
+ *                \         /
+ *                Conv 3x3
+ *                   |
+ *                 Relu
+ *                   |
+ *                Conv 1x1
+ *                   |
+ *                 Result
+ *
+ * Exports the network, whose constant edges (the decompressed and reordered weights) are stored in the
+ * compiled constants section, imports it back and compares the results of the imported network with the
+ * results of the original one
+ */
+
+class CompiledConstantsExportImportTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 10, 10}});
+
+        auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f16, {16, 16, 3, 3}, {}, true);
+        auto convert = std::make_shared<ngraph::opset8::Convert>(weights, ngPrc);
+        ov::mark_as_decompression(convert);
+        auto conv = std::make_shared<ngraph::opset8::Convolution>(inputParams[0], convert,
+                                                                  ngraph::Strides{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+        auto relu = ngraph::builder::makeActivation(conv, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, 8);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "CompiledConstantsExportImport");
+    }
+};
+
+namespace {
+TEST_F(CompiledConstantsExportImportTest, smoke_CompareWithOriginal_CPU) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto expectedOutputs = GetOutputs();
+
+    std::stringstream blob;
+    executableNetwork.Export(blob);
+    auto importedNetwork = core->ImportNetwork(blob, targetDevice, configuration);
+    auto request = importedNetwork.CreateInferRequest();
+
+    const auto& inputsInfo = executableNetwork.GetInputsInfo();
+    ASSERT_EQ(inputsInfo.size(), inputs.size());
+    size_t i = 0;
+    for (const auto& input : inputsInfo) {
+        request.SetBlob(input.first, inputs[i++]);
+    }
+    request.Infer();
+
+    const auto& outputsInfo = executableNetwork.GetOutputsInfo();
+    ASSERT_EQ(outputsInfo.size(), expectedOutputs.size());
+    i = 0;
+    for (const auto& output : outputsInfo) {
+        Compare(expectedOutputs[i++], request.GetBlob(output.first));
+    }
+}
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
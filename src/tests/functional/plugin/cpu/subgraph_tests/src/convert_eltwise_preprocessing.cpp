@@ -0,0 +1,56 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class ConvertEltwisePreprocessing : virtual public LayerTestsUtils::LayerTestsCommon,
+                                    public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::U8;
+        outPrc = Precision::FP32;
+
+        const std::vector<size_t> inputShape {1, 3, 16, 16};
+        auto input = ngraph::builder::makeParams(ngraph::element::u8, {inputShape});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input[0], ngraph::element::f32);
+
+        auto mean = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3, 1, 1}, {123.675f, 116.28f, 103.53f});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, mean);
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3, 1, 1}, {0.0171f, 0.0175f, 0.0174f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+
+        function = makeNgraphFunction(ngraph::element::f32, input, multiply, "ConvertEltwisePreprocessing");
+    }
+};
+
+/* The lowered mean/scale preprocessing of an U8 image.
+ * Test that the Convert node is folded into the Eltwise chain,
+ * so the image is converted and normalized in a single pass.
+
+      Input[U8]
+          |
+          X  No Convert
+          |
+   Eltwise[U8->FP32] (Subtract + Multiply)
+          |
+     Output[FP32]
+*/
+TEST_F(ConvertEltwisePreprocessing, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 1);
+}
+} // namespace SubgraphTestsDefinitions
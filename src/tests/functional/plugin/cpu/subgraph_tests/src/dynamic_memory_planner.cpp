@@ -0,0 +1,133 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+using namespace InferenceEngine;
+using ngraph::helpers::EltwiseTypes;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *            Parameter
+ *            /        \
+ *       Conv 3x3     Relu
+ *           |          |
+ *       MaxPool        |
+ *           |          |
+ *       Conv 1x1    MaxPool
+ *            \        /
+ *               Add
+ *                |
+ *              Result
+ *
+ * Checks the results of the dynamic shapes inferences with the memory planner (CPU_DYNAMIC_MEMORY_PLANNER)
+ * against the reference. The input shapes are repeated, so both the recorded and the applied plans are executed.
+ */
+
+class DynamicMemoryPlannerTest : public testing::WithParamInterface<std::string>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "DynamicMemoryPlanner=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_PLANNER, this->GetParam() });
+
+        InputShape inputShapes{{-1, 8, -1, -1}, {{1, 8, 16, 16}, {1, 8, 8, 8}, {1, 8, 16, 16}, {2, 8, 12, 12}, {1, 8, 8, 8}, {1, 8, 16, 16}}};
+        init_input_shapes({inputShapes});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto branch1 = ngraph::builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, 16);
+        branch1 = ngraph::builder::makePooling(branch1, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                               ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        branch1 = ngraph::builder::makeConvolution(branch1, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                   ngraph::op::PadType::EXPLICIT, 8);
+
+        auto branch2 = ngraph::builder::makeActivation(inputParams[0], ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        branch2 = ngraph::builder::makePooling(branch2, {2, 2}, {0, 0}, {0, 0}, {2, 2}, ngraph::op::RoundingType::FLOOR,
+                                               ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+
+        auto add = ngraph::builder::makeEltwise(branch1, branch2, EltwiseTypes::ADD);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicMemoryPlanner");
+    }
+};
+
+// Subgraph:
+/*
+ *      Parameter
+ *          |
+ *        Relu
+ *          |
+ *        Split
+ *        /   \
+ *     Relu   Relu
+ *        \   /
+ *         Add
+ *          |
+ *        Result
+ *
+ * The same input shapes are inferred several times in a row, so the plan is applied to the memory of the nodes whose
+ * shapes are not changed. Split keeps the pointers to the output memory between the inferences.
+ */
+
+class DynamicMemoryPlannerRepeatedShapesTest : public DynamicMemoryPlannerTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_PLANNER, this->GetParam() });
+
+        InputShape inputShapes{{-1, 8, -1}, {{1, 8, 64}, {1, 8, 64}, {1, 8, 64}, {2, 8, 32}, {2, 8, 32}, {2, 8, 32}, {1, 8, 64}}};
+        init_input_shapes({inputShapes});
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto relu = ngraph::builder::makeActivation(inputParams[0], ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto split = ngraph::builder::makeSplit(relu, ngPrc, 2, 1);
+        auto branch1 = ngraph::builder::makeActivation(split->output(0), ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto branch2 = ngraph::builder::makeActivation(split->output(1), ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto add = ngraph::builder::makeEltwise(branch1, branch2, EltwiseTypes::ADD);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "DynamicMemoryPlannerRepeatedShapes");
+    }
+};
+
+namespace {
+TEST_P(DynamicMemoryPlannerTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicMemoryPlanner_CPU, DynamicMemoryPlannerTest,
+                         testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         DynamicMemoryPlannerTest::getTestCaseName);
+
+TEST_P(DynamicMemoryPlannerRepeatedShapesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicMemoryPlannerRepeatedShapes_CPU, DynamicMemoryPlannerRepeatedShapesTest,
+                         testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         DynamicMemoryPlannerRepeatedShapesTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class EmbeddingType {
+    OffsetsSum,
+    PackedSum,
+    SegmentsSum
+};
+
+std::ostream& operator<<(std::ostream& os, EmbeddingType type) {
+    switch (type) {
+        case EmbeddingType::OffsetsSum: return os << "EmbeddingBagOffsetsSum";
+        case EmbeddingType::PackedSum: return os << "EmbeddingBagPackedSum";
+        case EmbeddingType::SegmentsSum: return os << "EmbeddingSegmentsSum";
+    }
+    return os;
+}
+
+using EmbeddingTableDecompressionParams = std::tuple<EmbeddingType,
+                                                     element::Type,  // table precision
+                                                     bool,           // per row scales, per tensor otherwise
+                                                     bool>;          // zero points
+
+/* The int8 embedding table is kept compressed and the decompression subgraph is fused into the embedding node
+
+     Constant[U8/I8]
+           |
+      Convert[FP32]
+           |
+      [Subtract]      Constant
+           |         /
+        Multiply            Parameter (per sample weights)
+            \                /
+          EmbeddingBag* / EmbeddingSegmentsSum
+*/
+class EmbeddingTableDecompression : public testing::WithParamInterface<EmbeddingTableDecompressionParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingTableDecompressionParams> obj) {
+        EmbeddingType type;
+        element::Type tablePrecision;
+        bool perRow;
+        bool withZeroPoints;
+        std::tie(type, tablePrecision, perRow, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << type << "_";
+        result << "tablePRC=" << tablePrecision << "_";
+        result << "perRow=" << perRow << "_";
+        result << "zeroPoints=" << withZeroPoints;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        element::Type tablePrecision;
+        bool perRow;
+        bool withZeroPoints;
+        std::tie(embeddingType, tablePrecision, perRow, withZeroPoints) = this->GetParam();
+
+        const std::string implType = InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" :
+                                     InferenceEngine::with_cpu_x86_avx2() ? "jit_avx2" : "ref_any";
+        selectedType = makeSelectedTypeStr(implType, element::i8);
+
+        // the row length is not a multiple of the vector length, so the tail of the row is accumulated too
+        const size_t N = 20;
+        const size_t D = 35;
+        const SizeVector tableShape{N, D};
+        const SizeVector paramsShape = perRow ? SizeVector{N, 1} : SizeVector{1};
+
+        std::shared_ptr<Node> table;
+        if (tablePrecision == element::u8) {
+            table = builder::makeConstant<uint8_t>(tablePrecision, tableShape, {}, true, 255, 0);
+        } else {
+            table = builder::makeConstant<int8_t>(tablePrecision, tableShape, {}, true, 127, -128);
+        }
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(table, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 4);
+            decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 0.1f, 0.01f);
+        decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+
+        const std::vector<int32_t> indices{0, 2, 19, 7, 7, 13, 5, 1};
+        auto indicesNode = opset1::Constant::create(element::i32, {indices.size()}, indices);
+        auto defaultIndex = opset1::Constant::create(element::i32, {}, {3});
+
+        std::shared_ptr<Node> embedding;
+        ParameterVector params;
+        switch (embeddingType) {
+            case EmbeddingType::OffsetsSum: {
+                params = builder::makeParams(element::f32, {{indices.size()}});
+                auto offsets = opset1::Constant::create(element::i32, {4}, {0, 2, 2, 5});
+                embedding = std::make_shared<opset3::EmbeddingBagOffsetsSum>(decompression, indicesNode, offsets,
+                                                                             defaultIndex, params[0]);
+                break;
+            }
+            case EmbeddingType::PackedSum: {
+                params = builder::makeParams(element::f32, {{2, indices.size() / 2}});
+                auto packedIndices = opset1::Constant::create(element::i32, {2, indices.size() / 2}, indices);
+                embedding = std::make_shared<opset3::EmbeddingBagPackedSum>(decompression, packedIndices, params[0]);
+                break;
+            }
+            case EmbeddingType::SegmentsSum: {
+                params = builder::makeParams(element::f32, {{indices.size()}});
+                auto segmentIds = opset1::Constant::create(element::i32, {indices.size()}, {0, 0, 2, 2, 2, 3, 5, 5});
+                auto numSegments = opset1::Constant::create(element::i32, {}, {6});
+                embedding = std::make_shared<opset3::EmbeddingSegmentsSum>(decompression, indicesNode, segmentIds,
+                                                                           numSegments, defaultIndex, params[0]);
+                break;
+            }
+        }
+
+        function = std::make_shared<Function>(NodeVector{embedding}, params, "EmbeddingTableDecompression");
+    }
+
+    EmbeddingType embeddingType;
+};
+
+TEST_P(EmbeddingTableDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    std::ostringstream nodeType;
+    nodeType << embeddingType;
+    CheckNumberOfNodesWithType(executableNetwork, nodeType.str(), 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    CheckPluginRelatedResults(executableNetwork, nodeType.str());
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingTableDecompression, EmbeddingTableDecompression,
+                         ::testing::Combine(::testing::Values(EmbeddingType::OffsetsSum,
+                                                              EmbeddingType::PackedSum,
+                                                              EmbeddingType::SegmentsSum),
+                                            ::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(false, true)),
+                         EmbeddingTableDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MatMulWeightsDecompressionParams = std::tuple<element::Type,  // weights precision
+                                                    bool,           // transpose weights
+                                                    size_t,         // group size, 0 for per-channel scales
+                                                    bool,           // zero points
+                                                    Precision>;     // inference precision
+
+/* The int8 (int4) weights are kept compressed and the decompression subgraph is fused into FullyConnected
+
+        Constant[U8/I8/U4/I4]
+              |
+         Convert[FP32]
+              |
+   Parameter  [Reshape]   Constant
+        \         |       /
+         \   [Subtract]      Constant
+          \       |         /
+           \   Multiply
+            \     |
+             \ [Reshape]
+              \   /
+              MatMul
+*/
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        element::Type weightsPrecision;
+        bool transposeWeights;
+        size_t groupSize;
+        bool withZeroPoints;
+        Precision inferencePrecision;
+        std::tie(weightsPrecision, transposeWeights, groupSize, withZeroPoints, inferencePrecision) = obj.param;
+
+        std::ostringstream result;
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "transpose=" << transposeWeights << "_";
+        result << "groupSize=" << groupSize << "_";
+        result << "zeroPoints=" << withZeroPoints << "_";
+        result << "inferPRC=" << inferencePrecision;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        element::Type weightsPrecision;
+        bool transposeWeights;
+        size_t groupSize;
+        bool withZeroPoints;
+        Precision inferencePrecision;
+        std::tie(weightsPrecision, transposeWeights, groupSize, withZeroPoints, inferencePrecision) = this->GetParam();
+
+        // the bf16 activations are consumed by the compressed FullyConnected as is
+        const bool bf16 = inferencePrecision == Precision::BF16 && InferenceEngine::with_cpu_x86_avx512_core();
+        configuration.insert({ PluginConfigParams::KEY_ENFORCE_BF16, bf16 ? PluginConfigParams::YES : PluginConfigParams::NO });
+        if (bf16)
+            threshold = 0.05f;
+
+        const std::string implType = InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" :
+                                     InferenceEngine::with_cpu_x86_avx2() ? "jit_avx2" : "ref_any";
+        selectedType = makeSelectedTypeStr(implType, bf16 ? element::bf16 : element::f32);
+
+        const size_t IC = 64;
+        const size_t OC = 40;
+        const bool grouped = groupSize != 0;
+        const size_t groups = grouped ? IC / groupSize : 1;
+
+        auto params = builder::makeParams(element::f32, {{2, 3, IC}});
+
+        // [O, G, K / G] for the grouped weights, [K, O] or [O, K] otherwise
+        SizeVector weightsShape = grouped ? SizeVector{OC, groups, groupSize} : transposeWeights ? SizeVector{OC, IC} : SizeVector{IC, OC};
+        SizeVector paramsShape = grouped ? SizeVector{OC, groups, 1} : transposeWeights ? SizeVector{OC, 1} : SizeVector{1, OC};
+
+        // the 8-bit weights cover the whole range, so they are not packed to 4 bits by the plugin
+        const auto weightsSize = shape_size(weightsShape);
+        std::shared_ptr<Node> weights;
+        if (weightsPrecision == element::u4) {
+            weights = std::make_shared<opset1::Constant>(weightsPrecision, weightsShape,
+                NGraphFunctions::Utils::generateVector<element::Type_t::u8>(weightsSize, 15, 0));
+        } else if (weightsPrecision == element::i4) {
+            weights = std::make_shared<opset1::Constant>(weightsPrecision, weightsShape,
+                NGraphFunctions::Utils::generateVector<element::Type_t::i8>(weightsSize, 7, -8));
+        } else if (weightsPrecision == element::u8) {
+            weights = builder::makeConstant<uint8_t>(weightsPrecision, weightsShape, {}, true, 255, 0);
+        } else {
+            weights = builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, 127, -128);
+        }
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 4);
+            decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, paramsShape, {}, true, 0.1f, 0.01f);
+        decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+        if (grouped) {
+            auto shape = opset1::Constant::create(element::i64, Shape{2}, {OC, IC});
+            decompression = std::make_shared<opset1::Reshape>(decompression, shape, false);
+        }
+
+        auto matMul = builder::makeMatMul(params[0], decompression, false, transposeWeights || grouped);
+        function = std::make_shared<Function>(NodeVector{matMul}, params, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+}
+
+// the weights are decompressed at the model loading if the weights decompression is disabled
+class MatMulWeightsDecompressionDisabled : public MatMulWeightsDecompression {
+protected:
+    void SetUp() override {
+        MatMulWeightsDecompression::SetUp();
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_WEIGHTS_DECOMPRESSION, PluginConfigParams::NO });
+    }
+};
+
+TEST_P(MatMulWeightsDecompressionDisabled, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    // FullyConnected gets the decompressed weights
+    auto function = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, function);
+    for (const auto& node : function->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "FullyConnected") {
+            ASSERT_EQ(node->get_input_element_type(1), element::f32);
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_PerChannel, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(element::u8, element::i8, element::u4, element::i4),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(0),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(Precision::FP32, Precision::BF16)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_Grouped, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(element::u8, element::u4),
+                                            ::testing::Values(true),
+                                            ::testing::Values(16, 32),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(Precision::FP32)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_Disabled, MatMulWeightsDecompressionDisabled,
+                         ::testing::Combine(::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(0),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(Precision::FP32)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_parallel.hpp>
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+using ngraph::helpers::EltwiseTypes;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                       Parameter
+ *             /         |          |        \
+ *       Conv 1x1    Conv 3x3   MaxPool   Relu
+ *           |          |          |        |
+ *         Relu       Conv 1x1   Conv 1x1  Add(inPlace)
+ *             \         |          |        /
+ *                    Concat (inPlace)
+ *                       |
+ *                     Result
+ *
+ * Checks the results of concurrent execution of independent branches
+ * (CPU_PARALLEL_GRAPH_EXECUTION) against the reference and that the branches
+ * are placed into the shared execution stages
+ */
+
+class ParallelBranchesTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "ParallelExecution=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, this->GetParam() });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 10, 10}});
+
+        auto branch1 = ngraph::builder::makeConvolution(inputParams[0], ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, 8);
+        branch1 = ngraph::builder::makeActivation(branch1, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+
+        auto branch2 = ngraph::builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::op::PadType::EXPLICIT, 8);
+        branch2 = ngraph::builder::makeConvolution(branch2, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                   ngraph::op::PadType::EXPLICIT, 8);
+
+        auto branch3 = ngraph::builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                    ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        branch3 = ngraph::builder::makeConvolution(branch3, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                   ngraph::op::PadType::EXPLICIT, 8);
+
+        auto branch4 = ngraph::builder::makeActivation(inputParams[0], ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        const auto addConst = ngraph::builder::makeConstant(ngPrc, std::vector<size_t>{1, 16, 1, 1}, std::vector<float>{}, true);
+        branch4 = ngraph::builder::makeEltwise(branch4, addConst, EltwiseTypes::ADD);
+
+        auto concat = ngraph::builder::makeConcat({branch1, branch2, branch3, branch4}, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranches");
+    }
+
+    void CheckExecutionStages() {
+        // number of the executable nodes in every stage reported by the execution graph
+        std::map<std::string, size_t> stageSizes;
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find("execStage");
+            if (it != rtInfo.end())
+                stageSizes[it->second.as<std::string>()]++;
+        }
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        const bool parallelExecution = this->GetParam() == PluginConfigParams::YES;
+#else
+        const bool parallelExecution = false;
+#endif
+        if (!parallelExecution) {
+            ASSERT_TRUE(stageSizes.empty());
+            return;
+        }
+
+        ASSERT_GT(stageSizes.size(), 1u);
+        // the first nodes of the branches depend on the input only, so they are executed concurrently
+        ASSERT_TRUE(std::any_of(stageSizes.begin(), stageSizes.end(), [](const std::pair<const std::string, size_t>& stage) {
+            return stage.second > 1;
+        }));
+    }
+};
+
+namespace {
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckExecutionStages();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches_CPU, ParallelBranchesTest,
+                         testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,197 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset8.hpp>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The operations which have no native CPU node are evaluated by the Reference node.
+// Checks the shape inference of the value dependent operation, the parallel evaluation of the large elementwise
+// operation, the repeated inference with changing dynamic shapes and the operation which rejects non-constant inputs.
+
+// elementwise operation unknown to the CPU plugin
+class NegateRef : public ov::op::util::UnaryElementwiseArithmetic {
+public:
+    OPENVINO_OP("NegateRef", "cpu_test", ov::op::util::UnaryElementwiseArithmetic);
+
+    NegateRef() = default;
+    explicit NegateRef(const ov::Output<ov::Node>& arg) : UnaryElementwiseArithmetic(arg) {
+        constructor_validate_and_infer_types();
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<NegateRef>(new_args.at(0));
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        const size_t size = inputs[0].get_size();
+        // the parts of the tensors are evaluated by the clones of the operation having the shapes of the parts
+        const auto& shape = get_input_partial_shape(0);
+        if (outputs[0].get_size() != size || (shape.is_static() && ov::shape_size(shape.to_shape()) != size))
+            return false;
+        const auto src = static_cast<const float*>(inputs[0].data());
+        const auto dst = static_cast<float*>(outputs[0].data());
+        for (size_t i = 0; i < size; i++)
+            dst[i] = -src[i];
+        return true;
+    }
+};
+
+// the 1D input repeated the number of times given by the second input, which can't be a Parameter
+class RepeatRef : public ov::op::Op {
+public:
+    OPENVINO_OP("RepeatRef", "cpu_test");
+
+    RepeatRef() = default;
+    RepeatRef(const ov::Output<ov::Node>& data, const ov::Output<ov::Node>& repeats) : Op({data, repeats}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        NODE_VALIDATION_CHECK(this,
+                              !ov::is_type<opset8::Parameter>(get_input_node_ptr(1)),
+                              "The repeats input can't be a Parameter");
+        const auto& dataShape = get_input_partial_shape(0);
+        ov::Dimension length = ov::Dimension::dynamic();
+        const auto repeats = ov::get_constant_from_source(input_value(1));
+        if (repeats && dataShape.rank().is_static() && dataShape[0].is_static())
+            length = dataShape[0].get_length() * repeats->cast_vector<int64_t>()[0];
+        set_output_type(0, get_input_element_type(0), ov::PartialShape{length});
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<RepeatRef>(new_args.at(0), new_args.at(1));
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        const size_t size = inputs[0].get_size();
+        const auto repeats = static_cast<size_t>(inputs[1].data<const int32_t>()[0]);
+        if (outputs[0].get_size() != size * repeats)
+            return false;
+        const auto src = static_cast<const float*>(inputs[0].data());
+        const auto dst = static_cast<float*>(outputs[0].data());
+        for (size_t r = 0; r < repeats; r++)
+            std::copy(src, src + size, dst + r * size);
+        return true;
+    }
+};
+
+namespace {
+
+ov::CompiledModel compileModel(const std::shared_ptr<ov::Model>& model) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU, ov::hint::inference_precision(ov::element::f32));
+    CheckNumberOfNodesWithType(compiledModel, "Reference", 1);
+    return compiledModel;
+}
+
+std::shared_ptr<ov::Model> createNegateModel(const PartialShape& shape) {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+    auto negate = std::make_shared<NegateRef>(param);
+    return std::make_shared<ov::Model>(negate, ParameterVector{param}, "NegateRef");
+}
+
+void inferNegate(ov::InferRequest& request, const Shape& shape) {
+    ov::Tensor input(element::f32, shape);
+    auto src = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        src[i] = static_cast<float>(i % 1000) - 500.f;
+    request.set_input_tensor(input);
+    request.infer();
+
+    const auto output = request.get_output_tensor();
+    ASSERT_EQ(output.get_shape(), shape);
+    const auto dst = output.data<const float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        ASSERT_EQ(dst[i], -src[i]) << "i = " << i << ", shape = " << shape;
+}
+
+}  // namespace
+
+TEST(ReferenceFallbackTest, ValueDependentShapeWithChangingValues) {
+    // the output shape of RandomUniform is the value of the first input
+    auto shape = std::make_shared<opset8::Parameter>(element::i32, Shape{2});
+    auto minValue = opset8::Constant::create(element::f32, Shape{}, {0.f});
+    auto maxValue = opset8::Constant::create(element::f32, Shape{}, {1.f});
+    auto randomUniform = std::make_shared<opset8::RandomUniform>(shape, minValue, maxValue, element::f32, 1, 1);
+    auto model = std::make_shared<ov::Model>(randomUniform, ParameterVector{shape}, "RandomUniform");
+    auto request = compileModel(model).create_infer_request();
+
+    for (const auto& dims : std::vector<std::vector<int32_t>>{{2, 3}, {5, 1}, {2, 3}, {16, 4096}, {1, 1}}) {
+        ov::Tensor input(element::i32, Shape{2});
+        std::copy(dims.begin(), dims.end(), input.data<int32_t>());
+        request.set_input_tensor(input);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), Shape(dims.begin(), dims.end()));
+        const auto data = output.data<const float>();
+        for (size_t i = 0; i < output.get_size(); i++) {
+            ASSERT_GE(data[i], 0.f) << "i = " << i;
+            ASSERT_LT(data[i], 1.f) << "i = " << i;
+        }
+    }
+}
+
+TEST(ReferenceFallbackTest, LargeElementwise) {
+    // the size is not divisible by the number of the threads, so the last part is smaller than the others
+    const Shape shape{3, 100003};
+    auto request = compileModel(createNegateModel(shape)).create_infer_request();
+    inferNegate(request, shape);
+    inferNegate(request, shape);
+}
+
+TEST(ReferenceFallbackTest, ChangingDynamicShapes) {
+    auto request = compileModel(createNegateModel({-1, -1})).create_infer_request();
+    // the small shapes are evaluated by one thread, the large ones are evaluated in parallel
+    for (const auto& shape : std::vector<Shape>{{2, 3}, {64, 1024}, {1, 100003}, {2, 3}, {64, 1024}, {7, 13}, {1, 100003}})
+        inferNegate(request, shape);
+}
+
+TEST(ReferenceFallbackTest, OperationRejectingNonConstantInputs) {
+    // the shape inference of RepeatRef throws on the Parameter inputs, so all its ports are value dependent
+    auto data = std::make_shared<opset8::Parameter>(element::f32, PartialShape{-1});
+    auto repeatsParam = std::make_shared<opset8::Parameter>(element::f32, Shape{1});
+    auto repeats = std::make_shared<opset8::Convert>(repeatsParam, element::i32);
+    auto repeat = std::make_shared<RepeatRef>(data, repeats);
+    auto model = std::make_shared<ov::Model>(repeat, ParameterVector{data, repeatsParam}, "RepeatRef");
+    auto request = compileModel(model).create_infer_request();
+
+    for (const auto& params : std::vector<std::pair<size_t, float>>{{3, 2.f}, {5, 1.f}, {3, 4.f}, {1000, 3.f}}) {
+        ov::Tensor dataTensor(element::f32, Shape{params.first});
+        auto src = dataTensor.data<float>();
+        for (size_t i = 0; i < params.first; i++)
+            src[i] = static_cast<float>(i);
+        ov::Tensor repeatsTensor(element::f32, Shape{1});
+        repeatsTensor.data<float>()[0] = params.second;
+        request.set_input_tensor(0, dataTensor);
+        request.set_input_tensor(1, repeatsTensor);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        const auto repeatsNum = static_cast<size_t>(params.second);
+        ASSERT_EQ(output.get_shape(), Shape{params.first * repeatsNum});
+        const auto dst = output.data<const float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(dst[i], src[i % params.first]) << "i = " << i;
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,80 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *          Parameter
+ *              |
+ *          Conv 3x3
+ *              |
+ *            Relu
+ *              |
+ *          Conv 1x1
+ *              |
+ *           Result
+ *
+ * Checks the results of the multi-stream network whose stream graphs share the compiled primitives
+ * (CPU_RUNTIME_CACHE_SHARED) against the reference, and that the stream graphs compiled on the same NUMA node take
+ * the primitives from the shared runtime cache
+ */
+
+class SharedStreamPrimitivesTest : public testing::WithParamInterface<std::string>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<std::string> obj) {
+        std::ostringstream result;
+        result << "SharePrimitives=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4" });
+        configuration.insert({ PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED, this->GetParam() });
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeParams(ngPrc, {{1, 16, 10, 10}});
+
+        auto conv = ngraph::builder::makeConvolution(inputParams[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16);
+        auto relu = ngraph::builder::makeActivation(conv, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        conv = ngraph::builder::makeConvolution(relu, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                ngraph::op::PadType::EXPLICIT, 8);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SharedStreamPrimitives");
+    }
+};
+
+namespace {
+TEST_P(SharedStreamPrimitivesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    if (GetParam() == PluginConfigParams::YES) {
+        // all the stream graphs are compiled at the network loading, the graphs after the first one hit the cache
+        const auto statistics = executableNetwork.GetMetric(PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_STATISTICS)
+                                    .as<std::map<std::string, uint64_t>>();
+        ASSERT_GT(statistics.at("misses"), 0u);
+        ASSERT_GT(statistics.at("hits"), 0u);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SharedStreamPrimitives_CPU, SharedStreamPrimitivesTest,
+                         testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         SharedStreamPrimitivesTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,90 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset8.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Parameter   ReadValue
+ *         \       /
+ *            Add
+ *          /     \
+ *      Assign   Result
+ *
+ * The state buffers of a request are bound to the graph shared by all the requests only during the inference.
+ * Checks that the requests created after the destruction of another one get the intact initial state.
+ */
+
+namespace {
+
+constexpr size_t elementsCount = 16;
+
+std::shared_ptr<ov::Model> createAccumulatorModel() {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, elementsCount});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{PartialShape{1, elementsCount}, element::f32, "accumulator"});
+    auto init = opset8::Constant::create(element::f32, Shape{1, elementsCount}, {0.f});
+    auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(param, readValue);
+    auto assign = std::make_shared<opset8::Assign>(add, variable);
+    auto result = std::make_shared<opset8::Result>(add);
+    return std::make_shared<ov::Model>(ResultVector{result}, SinkVector{assign}, ParameterVector{param}, "Accumulator");
+}
+
+void inferOnes(ov::InferRequest& request, size_t iterations) {
+    auto input = request.get_input_tensor();
+    std::fill_n(input.data<float>(), elementsCount, 1.f);
+    for (size_t i = 0; i < iterations; i++)
+        request.infer();
+}
+
+void checkState(ov::InferRequest& request, float expected) {
+    auto states = request.query_state();
+    ASSERT_EQ(states.size(), 1u);
+    auto state = states.front().get_state();
+    ASSERT_EQ(state.get_size(), elementsCount);
+    const auto data = state.data<const float>();
+    for (size_t i = 0; i < elementsCount; i++)
+        ASSERT_EQ(data[i], expected) << "i = " << i;
+}
+
+}  // namespace
+
+TEST(VariableStateLifetimeTest, StateIsIntactAfterRequestDestruction) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(createAccumulatorModel(), CommonTestUtils::DEVICE_CPU);
+
+    {
+        auto requestA = compiledModel.create_infer_request();
+        inferOnes(requestA, 3);
+        checkState(requestA, 3.f);
+    }
+    // reuse the memory released by the destroyed request
+    std::vector<float> garbage(elementsCount, 42.f);
+
+    auto requestB = compiledModel.create_infer_request();
+    checkState(requestB, 0.f);
+    inferOnes(requestB, 2);
+    checkState(requestB, 2.f);
+    ASSERT_EQ(requestB.get_output_tensor().data<const float>()[0], 2.f);
+}
+
+TEST(VariableStateLifetimeTest, RequestsKeepSeparateStates) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(createAccumulatorModel(), CommonTestUtils::DEVICE_CPU);
+
+    auto requestA = compiledModel.create_infer_request();
+    auto requestB = compiledModel.create_infer_request();
+    inferOnes(requestA, 3);
+    inferOnes(requestB, 1);
+    checkState(requestA, 3.f);
+    checkState(requestB, 1.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
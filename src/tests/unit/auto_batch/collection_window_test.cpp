@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "auto_batch.hpp"
+
+using namespace AutoBatchPlugin;
+using WorkerInferRequest = AutoBatchExecutableNetwork::WorkerInferRequest;
+using std::chrono::milliseconds;
+
+namespace {
+
+constexpr unsigned int timeOut = 1000;
+
+class AutoBatchCollectionWindowTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        worker._batchSize = 4;
+        // the time passes only when the test advances it
+        worker._now = [this] {
+            return now;
+        };
+    }
+
+    // starts the collection of the batch with the first request
+    void startCollection() {
+        worker.RegisterArrival(true);
+    }
+
+    void advance(milliseconds time) {
+        now += time;
+    }
+
+    int64_t collectionTimeMs(int collected) const {
+        return worker.GetCollectionTime(collected, timeOut).count();
+    }
+
+    WorkerInferRequest worker;
+    WorkerInferRequest::Clock::time_point now;
+};
+
+}  // namespace
+
+TEST_F(AutoBatchCollectionWindowTest, FixedTimeoutWithoutRequests) {
+    ASSERT_EQ(collectionTimeMs(0), timeOut);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, FixedTimeoutWithoutStatistics) {
+    startCollection();
+    ASSERT_EQ(collectionTimeMs(1), timeOut);
+    advance(milliseconds(250));
+    ASSERT_EQ(collectionTimeMs(1), timeOut - 250);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, TimeoutBoundsOldestRequest) {
+    startCollection();
+    advance(milliseconds(timeOut));
+    ASSERT_EQ(collectionTimeMs(1), 0);
+    advance(milliseconds(timeOut));
+    ASSERT_EQ(collectionTimeMs(1), 0);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, ShrinksBySlowerBatchedExecution) {
+    worker.RegisterExecution(milliseconds(300), true);
+    worker.RegisterExecution(milliseconds(100), false);
+    startCollection();
+    ASSERT_EQ(collectionTimeMs(1), timeOut - 200);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, NotShrunkByFasterBatchedExecution) {
+    worker.RegisterExecution(milliseconds(100), true);
+    worker.RegisterExecution(milliseconds(300), false);
+    startCollection();
+    ASSERT_EQ(collectionTimeMs(1), timeOut);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, FlushesWhenBatchCanNotBeCollectedInTime) {
+    startCollection();
+    // 3 more requests are expected in 1200 ms, that is later than the timeout
+    worker._avgInterArrivalMs = 400.;
+    ASSERT_EQ(collectionTimeMs(1), 0);
+    // but the last one is expected in time
+    ASSERT_EQ(collectionTimeMs(3), timeOut);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, GrowsWithArrivalRate) {
+    startCollection();
+    worker._avgInterArrivalMs = 400.;
+    ASSERT_EQ(collectionTimeMs(1), 0);
+
+    // the requests arrive back to back, so the average inter-arrival time decays and the window opens again
+    for (int i = 0; i < 16; i++) {
+        advance(milliseconds(1));
+        worker.RegisterArrival(false);
+    }
+    ASSERT_LT(worker._avgInterArrivalMs, 10.);
+    startCollection();
+    ASSERT_EQ(collectionTimeMs(1), timeOut);
+}
+
+TEST_F(AutoBatchCollectionWindowTest, ShrinksWithArrivalRate) {
+    startCollection();
+    ASSERT_EQ(collectionTimeMs(1), timeOut);
+
+    // the second request arrives in 600 ms, so the other 2 are not expected within the remaining 400 ms
+    advance(milliseconds(600));
+    worker.RegisterArrival(false);
+    ASSERT_DOUBLE_EQ(worker._avgInterArrivalMs, 600.);
+    ASSERT_EQ(collectionTimeMs(2), 0);
+}
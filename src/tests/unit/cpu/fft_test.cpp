@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <nodes/common/fft.h>
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+std::vector<std::complex<double>> naiveDFT(const std::vector<std::complex<double>>& x, bool inverse) {
+    const size_t n = x.size();
+    std::vector<std::complex<double>> result(n);
+    for (size_t k = 0; k < n; k++) {
+        for (size_t j = 0; j < n; j++) {
+            const double angle = 2. * PI * static_cast<double>((j * k) % n) / static_cast<double>(n);
+            result[k] += x[j] * std::polar(1., inverse ? angle : -angle);
+        }
+        if (inverse)
+            result[k] /= static_cast<double>(n);
+    }
+    return result;
+}
+
+std::vector<float> randomData(size_t size) {
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = distribution(generator);
+    return data;
+}
+
+class FFTPlanTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(FFTPlanTest, CompareWithNaiveDFT) {
+    const size_t n = GetParam();
+    const auto data = randomData(2 * n);
+    std::vector<std::complex<double>> x(n);
+    for (size_t i = 0; i < n; i++)
+        x[i] = {data[2 * i], data[2 * i + 1]};
+
+    FFTPlan plan(n);
+    std::vector<float> scratch(plan.scratchSize());
+    for (bool inverse : {false, true}) {
+        const auto expected = naiveDFT(x, inverse);
+        auto actual = data;
+        plan.execute(actual.data(), scratch.data(), inverse);
+        const double tolerance = 1e-5 * std::sqrt(static_cast<double>(n)) * (inverse ? 1. / n : 1.);
+        for (size_t k = 0; k < n; k++) {
+            ASSERT_NEAR(actual[2 * k], expected[k].real(), tolerance) << "k = " << k << ", inverse = " << inverse;
+            ASSERT_NEAR(actual[2 * k + 1], expected[k].imag(), tolerance) << "k = " << k << ", inverse = " << inverse;
+        }
+    }
+}
+
+TEST_P(FFTPlanTest, RealFFTCompareWithNaiveDFT) {
+    const size_t n = GetParam();
+    const auto data = randomData(n);
+    const auto expected = naiveDFT(std::vector<std::complex<double>>(data.begin(), data.end()), false);
+
+    RealFFTPlan plan(n);
+    std::vector<float> scratch(plan.scratchSize());
+    std::vector<float> spectrum(2 * (n / 2 + 1));
+    plan.forward(data.data(), spectrum.data(), scratch.data());
+    const double tolerance = 1e-5 * std::sqrt(static_cast<double>(n));
+    for (size_t k = 0; k <= n / 2; k++) {
+        ASSERT_NEAR(spectrum[2 * k], expected[k].real(), tolerance) << "k = " << k;
+        ASSERT_NEAR(spectrum[2 * k + 1], expected[k].imag(), tolerance) << "k = " << k;
+    }
+
+    std::vector<float> restored(n);
+    plan.inverse(spectrum.data(), restored.data(), scratch.data());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_NEAR(restored[i], data[i], 1e-5) << "i = " << i;
+    }
+}
+
+// powers of two, mixed radices 2/3/4/5 and the lengths computed with the Bluestein algorithm
+INSTANTIATE_TEST_SUITE_P(FFT, FFTPlanTest,
+                         ::testing::Values(1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 15, 16, 30, 49, 60, 97, 128, 400, 480, 1009));
+
+}  // namespace
@@ -13,9 +13,11 @@
 #include <ngraph_transformations/op/fully_connected.hpp>
 #include <ngraph_transformations/convert_matmul_to_fc.hpp>
 #include <ngraph_transformations/fc_bias_fusion.hpp>
+#include <ngraph_transformations/mark_weights_decompression.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_folding.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 
@@ -509,3 +511,184 @@ TEST(TransformationTests, ConvertMatMulToFCTest_second_input_rank_adj_3) {
     auto res = compare_functions(f, f_ref, true);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_per_channel) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 3 }, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3 }, { 1, 2, 3 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3 }, { 0.1f, 0.2f, 0.3f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MarkWeightsDecompression>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 3, 4 }, { 0, 3, 6, 9, 1, 4, 7, 10, 2, 5, 8, 11 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1 }, { 1, 2, 3 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1 }, { 0.1f, 0.2f, 0.3f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(2));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_per_channel_transposed) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 5, 2, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 3, 4 }, { -1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1 }, { 0.1f, 0.2f, 0.3f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MarkWeightsDecompression>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 5, 2, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 3, 4 }, { -1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1 }, { 0.1f, 0.2f, 0.3f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(3));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_grouped) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 2, 2, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 2, 1 }, { 1, 2, 3, 4 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 2, 1 }, { 0.1f, 0.2f, 0.3f, 0.4f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 2, 8 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, reshape, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<MarkWeightsDecompression>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 8 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 2, 8 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto groups_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, { 2, 2, 4 });
+        auto groups_reshape = std::make_shared<ngraph::opset1::Reshape>(convert, groups_shape, false);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 2, 1 }, { 1, 2, 3, 4 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(groups_reshape, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 2, 1 }, { 0.1f, 0.2f, 0.3f, 0.4f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto weights_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 2, 8 });
+        auto weights_reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, weights_shape, false);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, weights_reshape, ngraph::Rank(2));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+namespace {
+
+// The weights decompression subgraph which is not fused into FullyConnected must be folded
+void checkDecompressionIsFolded(const std::shared_ptr<ngraph::Function>& f, bool skip_fc_conversion = false) {
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<MarkWeightsDecompression>();
+    m.register_pass<ConvertMatMulToFC>();
+    m.register_pass<ngraph::pass::ConstantFolding>();
+    if (skip_fc_conversion) {
+        m.get_pass_config()->set_callback<ConvertMatMulToFC>([](const std::shared_ptr<const ngraph::Node>&) -> bool { return true; });
+    }
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    for (const auto& op : f->get_ordered_ops()) {
+        ASSERT_FALSE(ngraph::is_type<ngraph::opset1::Convert>(op)) << "the decompression is not folded: " << op;
+        if (ngraph::is_type<ngraph::opset1::MatMul>(op) || ngraph::is_type<FullyConnectedNode>(op)) {
+            ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(op->get_input_node_shared_ptr(1))) << op;
+        }
+    }
+}
+
+std::shared_ptr<ngraph::Function> makeDecompressionMatMul(const ngraph::Shape& input_shape,
+                                                           const ngraph::element::Type& precision,
+                                                           const ngraph::element::Type& weights_type,
+                                                           const ngraph::Shape& weights_shape,
+                                                           const ngraph::Shape& scale_shape,
+                                                           bool transpose_b) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(precision, input_shape);
+    auto weights = ngraph::opset1::Constant::create(weights_type, weights_shape, { 1 });
+    auto convert = std::make_shared<ngraph::opset1::Convert>(weights, precision);
+    auto scale = ngraph::opset1::Constant::create(precision, scale_shape, { 0.1f });
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+    auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, transpose_b);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+}
+
+}   // namespace
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_scale_along_input_channels_is_folded) {
+    // [K, O] weights with the scale of shape [K, 1]
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 2, 4 }, ngraph::element::f32, ngraph::element::u8, { 4, 3 }, { 4, 1 }, false));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_3D_weights_is_folded) {
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 2, 2, 4 }, ngraph::element::f32, ngraph::element::i8, { 1, 3, 4 }, { 1, 3, 1 }, true));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_4D_activations_is_folded) {
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 1, 1, 2, 4 }, ngraph::element::f32, ngraph::element::u8, { 3, 4 }, { 3, 1 }, true));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_u4_weights_is_folded) {
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 2, 4 }, ngraph::element::f32, ngraph::element::u4, { 3, 4 }, { 3, 1 }, true));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_f16_scale_is_folded) {
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 2, 4 }, ngraph::element::f16, ngraph::element::u8, { 3, 4 }, { 3, 1 }, true));
+}
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompression_skipped_by_callback_is_folded) {
+    checkDecompressionIsFolded(makeDecompressionMatMul({ 2, 4 }, ngraph::element::f32, ngraph::element::u8, { 3, 4 }, { 3, 1 }, true), true);
+}
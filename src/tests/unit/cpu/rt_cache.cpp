@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +12,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/concurrent_cache_entry.h"
 
 using namespace ov::intel_cpu;
 
@@ -345,7 +349,10 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
     auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
     auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
 
-    std::vector<MultiCache> vecCache(numThreads, MultiCache(capacity));
+    std::deque<MultiCache> vecCache;
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecCache.emplace_back(capacity);
+    }
 
     auto testRoutine = [&](MultiCache& cache) {
         //creating so we miss everytime
@@ -379,3 +386,107 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(LruCacheTests, EvictionsCount) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity);
+    ASSERT_NO_THROW(cache.evict(2));
+    ASSERT_EQ(cache.getEvictionsCount(), capacity + 2);
+}
+
+TEST(ConcurrentCacheEntryTests, GetOrCreate) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10 * ConcurrentCacheEntry<IntKey, ValueType>::shardsCount;
+
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    ConcurrentCacheEntry<IntKey, ValueType> entry(capacity);
+
+    for (int i = 0; i < 10; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        auto result = entry.getOrCreate({i}, builder);
+        ASSERT_NE(result.first, ValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Hit);
+    }
+    ASSERT_EQ(entry.getEvictionsCount(), 0u);
+}
+
+TEST(ConcurrentCacheEntryTests, InFlightDeduplication) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 8;
+
+    std::atomic_size_t buildsCount{0};
+    auto builder = [&](const IntKey& key) {
+        ++buildsCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<int>(key.data);
+    };
+
+    ConcurrentCacheEntry<IntKey, ValueType> entry(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto result = entry.getOrCreate({i}, builder);
+            ASSERT_NE(result.first, ValueType());
+            ASSERT_EQ(*result.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    ASSERT_EQ(buildsCount.load(), static_cast<size_t>(numKeys));
+}
+
+TEST(MultiCacheTests, ThreadSafeStatistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = MultiCache::ConcurrentEntryTypeT<IntKey, IntValueType>::shardsCount;
+    constexpr size_t numThreads = 8;
+    constexpr int numKeys = 4 * capacity;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, numThreads * numKeys);
+    ASSERT_GE(statistics.misses, static_cast<size_t>(numKeys));
+    ASSERT_GT(statistics.evictions, 0u);
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <serialize.h>
+
+#include <cstdint>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr uint64_t compiledConstantsMagic = 0x5354534E4F435043;  // "CPCONSTS"
+
+void write(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write(std::ostream& stream, const std::string& str) {
+    write(stream, str.size());
+    stream << str;
+}
+
+void write(std::ostream& stream, const std::vector<uint64_t>& dims) {
+    write(stream, dims.size());
+    for (auto dim : dims)
+        write(stream, dim);
+}
+
+std::stringstream section(uint64_t count) {
+    std::stringstream stream;
+    write(stream, compiledConstantsMagic);
+    write(stream, count);
+    return stream;
+}
+
+// the fp32 2x3 planar entry without the data
+void writeEntryDesc(std::ostream& stream, const std::string& precision = "FP32") {
+    write(stream, std::string("edge"));
+    write(stream, precision);
+    write(stream, std::vector<uint64_t>{2, 3});
+    write(stream, std::vector<uint64_t>{2, 3});
+    write(stream, std::vector<uint64_t>{0, 1});
+    write(stream, std::vector<uint64_t>{0, 0});
+    write(stream, std::vector<uint64_t>{3, 1});
+    write(stream, uint64_t{0});
+}
+
+// the buffer which doesn't support seeking, like a pipe
+class NonSeekableBuffer : public std::streambuf {
+public:
+    explicit NonSeekableBuffer(std::string data) : _data(std::move(data)) {
+        setg(&_data[0], &_data[0], &_data[0] + _data.size());
+    }
+
+private:
+    std::string _data;
+};
+
+}  // namespace
+
+TEST(CompiledConstantsDeserializerTest, InvalidMagic) {
+    std::stringstream stream("the section is not there");
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, EmptySection) {
+    auto stream = section(0);
+    CompiledConstants::CPtr constants;
+    CompiledConstantsDeserializer(stream) >> constants;
+    ASSERT_NE(constants, nullptr);
+}
+
+TEST(CompiledConstantsDeserializerTest, NonSeekableStream) {
+    auto content = section(1);
+    writeEntryDesc(content);
+    write(content, std::string(2 * 3 * sizeof(float), '\1'));
+    content << "the rest of the stream";
+
+    NonSeekableBuffer buffer(content.str());
+    std::istream stream(&buffer);
+    CompiledConstants::CPtr constants;
+    CompiledConstantsDeserializer(stream) >> constants;
+    ASSERT_NE(constants, nullptr);
+
+    std::string rest;
+    std::getline(stream, rest);
+    ASSERT_EQ(rest, "the rest of the stream");
+}
+
+TEST(CompiledConstantsDeserializerTest, HugeNameSize) {
+    auto stream = section(1);
+    write(stream, uint64_t{1} << 62);
+    stream << "name";
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, HugeDimsCount) {
+    auto stream = section(1);
+    write(stream, std::string("edge"));
+    write(stream, std::string("FP32"));
+    write(stream, uint64_t{1} << 62);
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, UnknownPrecision) {
+    auto stream = section(1);
+    writeEntryDesc(stream, "FP33");
+    write(stream, std::string(2 * 3 * sizeof(float), '\1'));
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, HugeDataSize) {
+    auto stream = section(1);
+    writeEntryDesc(stream);
+    write(stream, uint64_t{1} << 62);
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, DataSizeMismatch) {
+    auto stream = section(1);
+    writeEntryDesc(stream);
+    write(stream, std::string(2 * 3 * sizeof(float) - 1, '\1'));
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
+
+TEST(CompiledConstantsDeserializerTest, HugeEntriesCount) {
+    auto stream = section(uint64_t{1} << 62);
+    CompiledConstants::CPtr constants;
+    ASSERT_THROW(CompiledConstantsDeserializer(stream) >> constants, InferenceEngine::Exception);
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+// the software float runtime is built without MKL
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+
+namespace {
+
+std::vector<float> RandomVector(size_t size, std::mt19937& gen) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> v(size);
+    for (auto& x : v) {
+        x = dist(gen);
+    }
+    return v;
+}
+
+// the parallel kernels keep the accumulation order of every output, so the results are compared bit by bit
+
+TEST(GnaFloatRuntimeKernelsTest, sgemmMatchesReference) {
+    std::mt19937 gen(0);
+    for (int M : {1, 7, 300}) {
+        for (int N : {1, 5, 600}) {
+            for (int K : {3, 129}) {
+                for (float beta : {0.0f, 1.0f}) {
+                    const auto A = RandomVector(M * K, gen);
+                    const auto B = RandomVector(K * N, gen);
+                    auto C = RandomVector(M * N, gen);
+                    auto expected = C;
+                    for (int i = 0; i < M; i++) {
+                        for (int j = 0; j < N; j++) {
+                            float sum = (beta == 1.0f) ? expected[i * N + j] : 0;
+                            for (int k = 0; k < K; k++) {
+                                sum += A[i * K + k] * B[k * N + j];
+                            }
+                            expected[i * N + j] = sum;
+                        }
+                    }
+                    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0,
+                                 A.data(), K, B.data(), N, beta, C.data(), N);
+                    ASSERT_EQ(expected, C) << "M=" << M << " N=" << N << " K=" << K << " beta=" << beta;
+                }
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, sgemvSplitMatchesReference) {
+    std::mt19937 gen(0);
+    const uint32_t N = 500, K1 = 70, K2 = 90;
+    const auto A1 = RandomVector(K1, gen);
+    const auto A2 = RandomVector(K2, gen);
+    const auto X = RandomVector(N * (K1 + K2), gen);
+    const auto B = RandomVector(N, gen);
+    std::vector<float> expected(N), C(N);
+    for (uint32_t i = 0; i < N; i++) {
+        float sum = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            sum += A1[j] * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = K1; j < K1 + K2; j++) {
+            sum += A2[j - K1] * X[i * (K1 + K2) + j];
+        }
+        expected[i] = sum;
+    }
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    ASSERT_EQ(expected, C);
+}
+
+TEST(GnaFloatRuntimeKernelsTest, convolution2DMatchesReference) {
+    std::mt19937 gen(0);
+    const uint32_t IH = 9, IW = 11, IC = 3, OC = 5, KH = 3, KW = 2, SH = 2, SW = 1, PH = 1, PW = 1;
+    const uint32_t OH = (IH + 2 * PH - KH) / SH + 1;
+    const uint32_t OW = (IW + 2 * PW - KW) / SW + 1;
+    // every kernel is padded to 16B
+    const uint32_t kernelStride = (KH * KW * IC + 3) / 4 * 4;
+
+    auto filters = RandomVector(kernelStride * OC, gen);
+    auto biases = RandomVector(OC, gen);
+    auto input = RandomVector(IH * IW * IC, gen);
+    std::vector<float> expected(OH * OW * OC), output(OH * OW * OC);
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float sum = 0;
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        for (uint32_t kc = 0; kc < IC; kc++) {
+                            const int ih = static_cast<int>(oh * SH + kh) - static_cast<int>(PH);
+                            const int iw = static_cast<int>(ow * SW + kw) - static_cast<int>(PW);
+                            if (ih < 0 || ih >= static_cast<int>(IH) || iw < 0 || iw >= static_cast<int>(IW)) {
+                                continue;
+                            }
+                            sum += input[(ih * IW + iw) * IC + kc] * filters[oc * kernelStride + (kh * KW + kw) * IC + kc];
+                        }
+                    }
+                }
+                expected[(oh * OW + ow) * OC + oc] = sum + biases[oc];
+            }
+        }
+    }
+
+    intel_dnn_component_t component;
+    component.original_layer_name = "conv";
+    component.tensors = {{{1, IH, IW, IC}}, {{1, OH, OW, OC}}, {{OC, KH, KW, IC}}};
+    component.op.conv2D.convStride = {SH, SW};
+    component.op.conv2D.zeroPadding = {PH, PW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    CNN2DFilter32(&component);
+
+    ASSERT_EQ(expected, output);
+}
+
+} // namespace
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <numeric>
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
@@ -403,6 +404,30 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto createNetworkWithConstant = [](const std::vector<int64_t>& values) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i64, ngraph::Shape{values.size()});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{values.size()}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+
+    // the data is large enough to be hashed by several threads
+    std::vector<int64_t> values(8 * 1024 * 1024);
+    std::iota(values.begin(), values.end(), 0);
+    auto net1 = createNetworkWithConstant(values);
+    auto net2 = createNetworkWithConstant(values);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+
+    // the permuted data has the same sum of the values
+    std::swap(values.front(), values.back());
+    auto net3 = createNetworkWithConstant(values);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();